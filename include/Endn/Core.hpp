@@ -0,0 +1,753 @@
+/**
+ * \file Core.hpp
+ * \brief Templated load/store of integers and floats in a given byte order, used by GET_<TYPE>/SET_<TYPE>
+ */
+#ifndef __ENDN_CORE_HPP__
+#define __ENDN_CORE_HPP__
+
+// ─────────────────────────────────────────────────────────────
+//                  INCLUDE
+// ─────────────────────────────────────────────────────────────
+
+// Library Headers
+#include <Endn/Endn.hpp>
+#include <Endn/Helpers.hpp>
+
+// C++ Headers
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+// Policies that load/store full words instead of assembling bytes at runtime
+#if defined(ENDN_ACCESS_MEMCPY) || (defined(ENDN_ACCESS_ALIGNED) && defined(ENDN_ENABLE_BSWAP))
+#    define ENDN_ACCESS_WORDS
+#endif
+
+// ─────────────────────────────────────────────────────────────
+//                  DECLARATION
+// ─────────────────────────────────────────────────────────────
+
+namespace endn {
+namespace detail {
+
+inline std::uint8_t byteswap(const std::uint8_t val)
+{
+    return val;
+}
+
+inline std::uint16_t byteswap(const std::uint16_t val)
+{
+#if defined(__cpp_lib_byteswap)
+    return std::byteswap(val);
+#elif defined(ENDN_ENABLE_BSWAP)
+    return bswap_16(val);
+#else
+    return std::uint16_t((val << 8) | (val >> 8));
+#endif
+}
+
+inline std::uint32_t byteswap(const std::uint32_t val)
+{
+#if defined(__cpp_lib_byteswap)
+    return std::byteswap(val);
+#elif defined(ENDN_ENABLE_BSWAP)
+    return bswap_32(val);
+#else
+    return ((val & 0x000000FFu) << 24) | ((val & 0x0000FF00u) << 8) | ((val & 0x00FF0000u) >> 8) | ((val & 0xFF000000u) >> 24);
+#endif
+}
+
+inline std::uint64_t byteswap(const std::uint64_t val)
+{
+#if defined(__cpp_lib_byteswap)
+    return std::byteswap(val);
+#elif defined(ENDN_ENABLE_BSWAP)
+    return bswap_64(val);
+#else
+    return (std::uint64_t(byteswap(std::uint32_t(val))) << 32) | byteswap(std::uint32_t(val >> 32));
+#endif
+}
+
+inline uint128_t byteswap(const uint128_t val)
+{
+    return MAKE_UINT128(byteswap(UINT128_LOW(val)), byteswap(UINT128_HIGH(val)));
+}
+
+/**
+ * \brief Unsigned integer holding the bits of T
+ */
+template<typename T>
+struct bits
+{
+    static_assert(std::is_integral<T>::value && std::is_unsigned<T>::value, "Unsupported type");
+    typedef T type;
+};
+
+template<>
+struct bits<int8_t>
+{
+    typedef std::uint8_t type;
+};
+
+template<>
+struct bits<int16_t>
+{
+    typedef std::uint16_t type;
+};
+
+template<>
+struct bits<int32_t>
+{
+    typedef std::uint32_t type;
+};
+
+template<>
+struct bits<int64_t>
+{
+    typedef std::uint64_t type;
+};
+
+template<>
+struct bits<float>
+{
+    typedef std::uint32_t type;
+};
+
+template<>
+struct bits<double>
+{
+    typedef std::uint64_t type;
+};
+
+/**
+ * \brief Assemble Size bytes stored in the given order. Usable in constant expressions.
+ */
+template<typename U, Order order, std::size_t Size>
+ENDN_CONSTEXPR inline U load_bytes(const std::uint8_t* buf)
+{
+    U value = 0;
+    for(std::size_t i = 0; i < Size; ++i)
+        value = U(value | (U(buf[order == Order::LITTLE ? i : Size - 1 - i]) << (8 * i)));
+    return value;
+}
+
+template<Order order, std::size_t Size, std::size_t I, typename U>
+ENDN_CONSTEXPR inline void store_byte(std::uint8_t*, const U, std::false_type /*I < Size*/)
+{
+}
+
+/**
+ * \brief Write the byte I of val, then the following ones. One fixed store per byte, without a loop.
+ */
+template<Order order, std::size_t Size, std::size_t I, typename U>
+ENDN_CONSTEXPR inline void store_byte(std::uint8_t* buf, const U val, std::true_type /*I < Size*/)
+{
+    buf[order == Order::LITTLE ? I : Size - 1 - I] = std::uint8_t(val >> (8 * I));
+    store_byte<order, Size, I + 1>(buf, val, std::integral_constant<bool, (I + 1 < Size)>());
+}
+
+/**
+ * \brief Write the Size low bytes of val in the given order. Usable in constant expressions.
+ * At run time the bytes are assembled in a local array, then copied with a fixed size memcpy (byte stores where
+ * unaligned accesses fault). Storing them one by one in buf let GCC 12 vectorize the caller loop and report an overflow.
+ */
+template<typename U, Order order, std::size_t Size>
+ENDN_CONSTEXPR inline void store_bytes(std::uint8_t* buf, const U val)
+{
+    if(ENDN_IS_CONSTANT_EVALUATED())
+    {
+        store_byte<order, Size, 0>(buf, val, std::integral_constant<bool, (0 < Size)>());
+        return;
+    }
+    std::uint8_t bytes[Size] = {};
+    store_byte<order, Size, 0>(bytes, val, std::integral_constant<bool, (0 < Size)>());
+    std::memcpy(buf, bytes, Size);
+}
+
+/**
+ * \brief Read Size bytes stored in the given order at any address, without reading past them.
+ * The memcpy compile to unaligned loads (followed by a bswap if the order isn't the host one).
+ */
+template<typename U, Order order, std::size_t Size>
+inline U load_words(const std::uint8_t* buf, std::false_type /*aligned*/)
+{
+    // Place the bytes as the low part of an U in the buffer order
+    U value = 0;
+    std::memcpy(reinterpret_cast<std::uint8_t*>(&value) + (order == Order::BIG ? sizeof(U) - Size : 0), buf, Size);
+    return order == HOST_ORDER ? value : byteswap(value);
+}
+
+/**
+ * \brief Direct access when buf is aligned, byte by byte otherwise (ENDN_ACCESS_ALIGNED)
+ */
+template<typename U, Order order, std::size_t Size>
+inline U load_words(const std::uint8_t* buf, std::true_type /*aligned*/)
+{
+    if(Size == sizeof(U) && std::uintptr_t(buf) % sizeof(U) == 0)
+    {
+        const U value = *reinterpret_cast<const U*>(buf);
+        return order == HOST_ORDER ? value : byteswap(value);
+    }
+    if(Size == sizeof(U))
+        return load_bytes<U, order, Size>(buf);
+    return load_words<U, order, Size>(buf, std::false_type());
+}
+
+/**
+ * \brief Write the Size low bytes of val in the given order at any address
+ */
+template<typename U, Order order, std::size_t Size>
+inline void store_words(std::uint8_t* buf, const U val, std::false_type /*aligned*/)
+{
+    const U value = order == HOST_ORDER ? val : byteswap(val);
+    std::memcpy(buf, reinterpret_cast<const std::uint8_t*>(&value) + (order == Order::BIG ? sizeof(U) - Size : 0), Size);
+}
+
+template<typename U, Order order, std::size_t Size>
+inline void store_words(std::uint8_t* buf, const U val, std::true_type /*aligned*/)
+{
+    if(Size == sizeof(U) && std::uintptr_t(buf) % sizeof(U) == 0)
+        *reinterpret_cast<U*>(buf) = order == HOST_ORDER ? val : byteswap(val);
+    else if(Size == sizeof(U))
+        store_bytes<U, order, Size>(buf, val);
+    else
+        store_words<U, order, Size>(buf, val, std::false_type());
+}
+
+#ifdef ENDN_ACCESS_ALIGNED
+typedef std::true_type access_aligned;
+#else
+typedef std::false_type access_aligned;
+#endif
+
+/**
+ * \brief Read Size bytes in the given order with the ENDN_ACCESS policy
+ */
+template<typename U, Order order, std::size_t Size>
+ENDN_CONSTEXPR inline U load_bits(const std::uint8_t* buf)
+{
+#ifdef ENDN_ACCESS_WORDS
+    if(!ENDN_IS_CONSTANT_EVALUATED())
+        return load_words<U, order, Size>(buf, access_aligned());
+#endif
+    return load_bytes<U, order, Size>(buf);
+}
+
+/**
+ * \brief Write the Size low bytes of val in the given order with the ENDN_ACCESS policy
+ */
+template<typename U, Order order, std::size_t Size>
+ENDN_CONSTEXPR inline void store_bits(std::uint8_t* buf, const U val)
+{
+#ifdef ENDN_ACCESS_WORDS
+    if(!ENDN_IS_CONSTANT_EVALUATED())
+    {
+        store_words<U, order, Size>(buf, val, access_aligned());
+        return;
+    }
+#endif
+    store_bytes<U, order, Size>(buf, val);
+}
+
+/**
+ * \brief Read Size bytes stored in the given order with a single sizeof(U) unaligned load.
+ * The sizeof(U) - Size bytes that follow the field are read and dropped, so they must be readable.
+ */
+template<typename U, Order order, std::size_t Size>
+inline U load_padded_words(const std::uint8_t* buf)
+{
+    U value;
+    std::memcpy(&value, buf, sizeof(U));
+    value = order == HOST_ORDER ? value : byteswap(value);
+    // The field is in the most significant bytes of a big endian load, in the least significant ones otherwise
+    const std::size_t shift = 8 * (sizeof(U) - Size);
+    return order == Order::BIG ? U(value >> shift) : U(U(value << shift) >> shift);
+}
+
+/**
+ * \brief Read Size bytes in the given order, allowed to read up to sizeof(U) bytes from buf
+ */
+template<typename U, Order order, std::size_t Size>
+ENDN_CONSTEXPR inline U load_padded_bits(const std::uint8_t* buf)
+{
+#ifdef ENDN_ACCESS_WORDS
+    if(!ENDN_IS_CONSTANT_EVALUATED())
+        return load_padded_words<U, order, Size>(buf);
+#endif
+    return load_bytes<U, order, Size>(buf);
+}
+
+/**
+ * \brief Read size (1 to 8) bytes stored in the given order into the low bytes of an std::uint64_t.
+ * Usable in constant expressions.
+ */
+template<Order order>
+ENDN_CONSTEXPR inline std::uint64_t load_var_bytes(const std::uint8_t* buf, const std::size_t size)
+{
+    std::uint64_t value = 0;
+    for(std::size_t i = 0; i < size; ++i)
+        value |= std::uint64_t(buf[order == Order::LITTLE ? i : size - 1 - i]) << (8 * i);
+    return value;
+}
+
+/**
+ * \brief Read size (1 to 8) bytes stored in the given order, without reading past them.
+ * From 4 bytes the first and last 4 bytes are loaded, below the first, middle and last bytes.
+ * The loads overlap on equal bytes, so they are combined with a or, and the only branch is on size >= 4.
+ */
+template<Order order>
+inline std::uint64_t load_var_words(const std::uint8_t* buf, const std::size_t size)
+{
+    if(size >= 4)
+    {
+        const std::uint64_t head = load_words<std::uint32_t, order, 4>(buf, std::false_type());
+        const std::uint64_t tail = load_words<std::uint32_t, order, 4>(buf + size - 4, std::false_type());
+        const std::size_t shift = 8 * (size - 4);
+        return order == Order::BIG ? (head << shift) | tail : head | (tail << shift);
+    }
+    const std::size_t mid = size / 2;
+    if(order == Order::BIG)
+        return (std::uint64_t(buf[0]) << (8 * (size - 1))) | (std::uint64_t(buf[mid]) << (8 * (size - 1 - mid))) | buf[size - 1];
+    return buf[0] | (std::uint64_t(buf[mid]) << (8 * mid)) | (std::uint64_t(buf[size - 1]) << (8 * (size - 1)));
+}
+
+/**
+ * \brief Read size (1 to 8) bytes stored in the given order, without reading past them
+ */
+template<Order order>
+ENDN_CONSTEXPR inline std::uint64_t load_var(const std::uint8_t* buf, const std::size_t size)
+{
+#ifdef ENDN_ACCESS_WORDS
+    if(!ENDN_IS_CONSTANT_EVALUATED())
+        return load_var_words<order>(buf, size);
+#endif
+    return load_var_bytes<order>(buf, size);
+}
+
+/**
+ * \brief Read size (1 to 8) bytes stored in the given order with a single 8 bytes load and a shift, without any branch.
+ * The 8 - size bytes that follow the field must be readable.
+ */
+template<Order order>
+ENDN_CONSTEXPR inline std::uint64_t load_var_padded(const std::uint8_t* buf, const std::size_t size)
+{
+#ifdef ENDN_ACCESS_WORDS
+    if(!ENDN_IS_CONSTANT_EVALUATED())
+    {
+        const std::uint64_t value = load_padded_words<std::uint64_t, order, sizeof(std::uint64_t)>(buf);
+        const std::size_t shift = 8 * (sizeof(value) - size);
+        return order == Order::BIG ? value >> shift : (value << shift) >> shift;
+    }
+#endif
+    return load_var_bytes<order>(buf, size);
+}
+
+/**
+ * \brief Write the size (1 to 8) low bytes of val in the given order, without writing past them.
+ * Same as load_var_words: from 4 bytes the first and last 4 bytes are stored, below the first, middle and last bytes.
+ * The stores overlap on equal bytes, so there is no runtime length memcpy and the only branch is on size >= 4.
+ */
+template<Order order>
+inline void store_var_words(std::uint8_t* buf, const std::uint64_t val, const std::size_t size)
+{
+    if(size >= 4)
+    {
+        const std::uint32_t high = std::uint32_t(val >> (8 * (size - 4)));
+        const std::uint32_t low = std::uint32_t(val);
+        store_words<std::uint32_t, order, 4>(buf, order == Order::BIG ? high : low, std::false_type());
+        store_words<std::uint32_t, order, 4>(buf + size - 4, order == Order::BIG ? low : high, std::false_type());
+        return;
+    }
+    const std::size_t mid = size / 2;
+    buf[0] = std::uint8_t(val >> (order == Order::BIG ? 8 * (size - 1) : 0));
+    buf[mid] = std::uint8_t(val >> (8 * (order == Order::BIG ? size - 1 - mid : mid)));
+    buf[size - 1] = std::uint8_t(val >> (order == Order::BIG ? 0 : 8 * (size - 1)));
+}
+
+/**
+ * \brief Write the size (1 to 8) low bytes of val in the given order
+ */
+template<Order order>
+ENDN_CONSTEXPR inline void store_var(std::uint8_t* buf, const std::uint64_t val, const std::size_t size)
+{
+#ifdef ENDN_ACCESS_WORDS
+    if(!ENDN_IS_CONSTANT_EVALUATED())
+    {
+        store_var_words<order>(buf, val, size);
+        return;
+    }
+#endif
+    for(std::size_t i = 0; i < size; ++i)
+        buf[order == Order::LITTLE ? i : size - 1 - i] = std::uint8_t(val >> (8 * i));
+}
+
+/**
+ * \brief Sign extend the size (1 to 8) low bytes of value
+ */
+ENDN_CONSTEXPR inline int64_t sign_extend_var(const std::uint64_t value, const std::size_t size)
+{
+    const std::uint64_t sign = std::uint64_t(1) << (8 * size - 1);
+    return bit_cast<int64_t>((value ^ sign) - sign);
+}
+
+/**
+ * \brief Convert Size bytes read in bits to T. Signed integers narrower than T are sign extended.
+ */
+template<typename T, std::size_t Size, typename U>
+ENDN_CONSTEXPR inline T from_bits(const U value)
+{
+    return std::is_signed<T>::value && std::is_integral<T>::value && Size < sizeof(T)
+               ? bit_cast<T>(U((value ^ (U(1) << (8 * Size - 1))) - (U(1) << (8 * Size - 1))))
+               : bit_cast<T>(value);
+}
+
+
+/**
+ * \brief Widen an IEEE binary16 to float. Exact for every value (subnormals, infinities and NaN included).
+ * The exponent is rebiased with integer ops, subnormals are normalized by a single float subtraction.
+ */
+ENDN_CONSTEXPR inline float half_to_float(const std::uint16_t half)
+{
+    const std::uint32_t shifted = std::uint32_t(half & 0x7FFF) << 13;
+    const std::uint32_t exponent = shifted & 0x0F800000u;
+    std::uint32_t bits = shifted + (std::uint32_t(127 - 15) << 23);
+    if(exponent == 0x0F800000u)
+        bits += std::uint32_t(128 - 16) << 23;
+    else if(exponent == 0)
+        bits = bit_cast<std::uint32_t>(bit_cast<float>(bits + (1u << 23)) - bit_cast<float>(113u << 23));
+    return bit_cast<float>(bits | (std::uint32_t(half & 0x8000) << 16));
+}
+
+/**
+ * \brief Narrow a float to IEEE binary16, rounding to nearest even. Overflows give infinities, NaN a quiet NaN.
+ */
+ENDN_CONSTEXPR inline std::uint16_t float_to_half(const float val)
+{
+    const std::uint32_t bits = bit_cast<std::uint32_t>(val);
+    const std::uint16_t sign = std::uint16_t((bits >> 16) & 0x8000);
+    const std::uint32_t magnitude = bits & 0x7FFFFFFFu;
+    if(magnitude >= (std::uint32_t(127 + 16) << 23))
+        return std::uint16_t(sign | (magnitude > 0x7F800000u ? 0x7E00 : 0x7C00));
+    if(magnitude < (113u << 23))
+    {
+        // Adding 0.5 align the subnormal mantissa on the 10 lsb, the float addition round it
+        const std::uint32_t magic = std::uint32_t((127 - 15) + (23 - 10) + 1) << 23;
+        return std::uint16_t(sign | (bit_cast<std::uint32_t>(bit_cast<float>(magnitude) + bit_cast<float>(magic)) - magic));
+    }
+    const std::uint32_t odd = (magnitude >> 13) & 1;
+    return std::uint16_t(sign | ((magnitude - (std::uint32_t(127 - 15) << 23) + 0xFFF + odd) >> 13));
+}
+
+/**
+ * \brief Widen a bfloat16 to float, it is the 16 msb of the float.
+ */
+ENDN_CONSTEXPR inline float bfloat16_to_float(const std::uint16_t half)
+{
+    return bit_cast<float>(std::uint32_t(half) << 16);
+}
+
+/**
+ * \brief Narrow a float to bfloat16, rounding to nearest even. NaN stay quiet NaN.
+ */
+ENDN_CONSTEXPR inline std::uint16_t float_to_bfloat16(const float val)
+{
+    const std::uint32_t bits = bit_cast<std::uint32_t>(val);
+    if((bits & 0x7FFFFFFFu) > 0x7F800000u)
+        return std::uint16_t((bits >> 16) | 0x40);
+    return std::uint16_t((bits + 0x7FFF + ((bits >> 16) & 1)) >> 16);
+}
+
+/**
+ * \brief 2^-fraction, the value of one unit of a fixed point integer
+ */
+template<typename T>
+constexpr T fixed_scale(const unsigned fraction)
+{
+    return T(1) / T(std::uint64_t(1) << fraction);
+}
+
+/**
+ * \brief Round to nearest, ties to even like the cvt instructions. |value| must be below 2^62.
+ */
+ENDN_CONSTEXPR inline double round_even(const double value)
+{
+    const std::int64_t truncated = std::int64_t(value);
+    const double rest = value - double(truncated);
+    const bool odd = truncated % 2 != 0;
+    if(rest > 0.5 || (rest == 0.5 && odd))
+        return double(truncated + 1);
+    if(rest < -0.5 || (rest == -0.5 && odd))
+        return double(truncated - 1);
+    return double(truncated);
+}
+
+/**
+ * \brief Fixed point integer of value (already multiplied by 2^Fraction), saturated to the Int range. NaN give 0.
+ */
+template<typename Int>
+ENDN_CONSTEXPR inline Int saturate_fixed(const double value)
+{
+    const double low = double(std::numeric_limits<Int>::min());
+    const double high = double(std::numeric_limits<Int>::max());
+    if(value != value)
+        return 0;
+    return Int(round_even(value < low ? low : value > high ? high : value));
+}
+}
+
+// ─────────────────────────────────────────────────────────────
+//                  API
+// ─────────────────────────────────────────────────────────────
+
+/**
+ * \brief Read a T stored in 'order' at buf + offset.
+ * T can be any fixed width integer, float or double. Size allow to read narrower integers (ie 6 for 48 bits),
+ * that are then zero or sign extended.
+ * \tparam T Host type to return
+ * \tparam order Byte order of the buffer
+ * \tparam Size Number of bytes to read, sizeof(T) by default
+ */
+template<typename T, Order order, std::size_t Size = sizeof(T)>
+ENDN_CONSTEXPR inline T load(const std::uint8_t* buf, const std::size_t offset = 0)
+{
+    static_assert(Size >= 1 && Size <= sizeof(T), "Size must be between 1 and sizeof(T)");
+    return detail::from_bits<T, Size>(detail::load_bits<typename detail::bits<T>::type, order, Size>(buf + offset));
+}
+
+/**
+ * \brief Same as load, on any kind of buffer (char, void, ...). Not constexpr.
+ */
+template<typename T, Order order, std::size_t Size = sizeof(T)>
+inline T load(const void* buf, const std::size_t offset = 0)
+{
+    return load<T, order, Size>(static_cast<const std::uint8_t*>(buf), offset);
+}
+
+/**
+ * \brief Same as load, but always read sizeof(T) bytes at buf + offset, even when Size is smaller.
+ * It avoid assembling odd width integers (24, 48 bits, ...) from several loads, when the buffer guarantee
+ * that sizeof(T) - Size bytes (at most PADDING_SIZE) are readable past the field.
+ */
+template<typename T, Order order, std::size_t Size = sizeof(T)>
+ENDN_CONSTEXPR inline T load_padded(const std::uint8_t* buf, const std::size_t offset = 0)
+{
+    static_assert(Size >= 1 && Size <= sizeof(T), "Size must be between 1 and sizeof(T)");
+    return detail::from_bits<T, Size>(detail::load_padded_bits<typename detail::bits<T>::type, order, Size>(buf + offset));
+}
+
+/**
+ * \brief Same as load_padded, on any kind of buffer (char, void, ...). Not constexpr.
+ */
+template<typename T, Order order, std::size_t Size = sizeof(T)>
+inline T load_padded(const void* buf, const std::size_t offset = 0)
+{
+    return load_padded<T, order, Size>(static_cast<const std::uint8_t*>(buf), offset);
+}
+
+/**
+ * \brief Read a uint128_t stored in 'order' at buf + offset, as two 64 bits halves.
+ * \tparam order Byte order of the buffer
+ */
+template<Order order>
+ENDN_CONSTEXPR inline uint128_t load_uint128(const std::uint8_t* buf, const std::size_t offset = 0)
+{
+    return order == Order::BIG
+               ? MAKE_UINT128(load<std::uint64_t, order>(buf, offset), load<std::uint64_t, order>(buf, offset + UINT64_SIZE))
+               : MAKE_UINT128(load<std::uint64_t, order>(buf, offset + UINT64_SIZE), load<std::uint64_t, order>(buf, offset));
+}
+
+/**
+ * \brief Same as load_uint128, on any kind of buffer (char, void, ...). Not constexpr.
+ */
+template<Order order>
+inline uint128_t load_uint128(const void* buf, const std::size_t offset = 0)
+{
+    return load_uint128<order>(static_cast<const std::uint8_t*>(buf), offset);
+}
+
+/**
+ * \brief Read an IEEE binary16 stored in 'order' at buf + offset, widened to float.
+ * \tparam order Byte order of the buffer
+ */
+template<Order order>
+ENDN_CONSTEXPR inline float load_float16(const std::uint8_t* buf, const std::size_t offset = 0)
+{
+    return detail::half_to_float(load<std::uint16_t, order>(buf, offset));
+}
+
+/**
+ * \brief Same as load_float16, on any kind of buffer (char, void, ...). Not constexpr.
+ */
+template<Order order>
+inline float load_float16(const void* buf, const std::size_t offset = 0)
+{
+    return load_float16<order>(static_cast<const std::uint8_t*>(buf), offset);
+}
+
+/**
+ * \brief Read a bfloat16 stored in 'order' at buf + offset, widened to float.
+ * \tparam order Byte order of the buffer
+ */
+template<Order order>
+ENDN_CONSTEXPR inline float load_bfloat16(const std::uint8_t* buf, const std::size_t offset = 0)
+{
+    return detail::bfloat16_to_float(load<std::uint16_t, order>(buf, offset));
+}
+
+/**
+ * \brief Same as load_bfloat16, on any kind of buffer (char, void, ...). Not constexpr.
+ */
+template<Order order>
+inline float load_bfloat16(const void* buf, const std::size_t offset = 0)
+{
+    return load_bfloat16<order>(static_cast<const std::uint8_t*>(buf), offset);
+}
+
+/**
+ * \brief Read a fixed point Format stored in 'order' at buf + offset, as a float or a double.
+ * \tparam Format Fixed point format (endn::Q15, endn::Fixed<int32_t, 20>, ...)
+ * \tparam order Byte order of the buffer
+ * \tparam T float or double
+ */
+template<typename Format, Order order, typename T = double>
+ENDN_CONSTEXPR inline T load_fixed(const std::uint8_t* buf, const std::size_t offset = 0)
+{
+    static_assert(std::is_floating_point<T>::value, "Fixed point are read as float or double");
+    return T(load<typename Format::type, order>(buf, offset)) * detail::fixed_scale<T>(Format::FRACTION);
+}
+
+/**
+ * \brief Same as load_fixed, on any kind of buffer (char, void, ...). Not constexpr.
+ */
+template<typename Format, Order order, typename T = double>
+inline T load_fixed(const void* buf, const std::size_t offset = 0)
+{
+    return load_fixed<Format, order, T>(static_cast<const std::uint8_t*>(buf), offset);
+}
+
+/**
+ * \brief Write val in 'order' at buf + offset. Only the Size low bytes of integers are written.
+ * \tparam T Host type to write
+ * \tparam order Byte order of the buffer
+ * \tparam Size Number of bytes to write, sizeof(T) by default
+ */
+template<typename T, Order order, std::size_t Size = sizeof(T)>
+ENDN_CONSTEXPR inline void store(std::uint8_t* buf, const std::size_t offset, const T val)
+{
+    static_assert(Size >= 1 && Size <= sizeof(T), "Size must be between 1 and sizeof(T)");
+    detail::store_bits<typename detail::bits<T>::type, order, Size>(buf + offset, detail::bit_cast<typename detail::bits<T>::type>(val));
+}
+
+/**
+ * \brief Same as store, on any kind of buffer (char, void, ...). Not constexpr.
+ */
+template<typename T, Order order, std::size_t Size = sizeof(T)>
+inline void store(void* buf, const std::size_t offset, const T val)
+{
+    store<T, order, Size>(static_cast<std::uint8_t*>(buf), offset, val);
+}
+
+/**
+ * \brief Write val in 'order' at buf
+ */
+template<typename T, Order order, std::size_t Size = sizeof(T)>
+ENDN_CONSTEXPR inline void store(std::uint8_t* buf, const T val)
+{
+    store<T, order, Size>(buf, 0, val);
+}
+
+/**
+ * \brief Same as store, on any kind of buffer (char, void, ...). Not constexpr.
+ */
+template<typename T, Order order, std::size_t Size = sizeof(T)>
+inline void store(void* buf, const T val)
+{
+    store<T, order, Size>(static_cast<std::uint8_t*>(buf), 0, val);
+}
+
+/**
+ * \brief Write a uint128_t in 'order' at buf + offset, as two 64 bits halves.
+ * \tparam order Byte order of the buffer
+ */
+template<Order order>
+ENDN_CONSTEXPR inline void store_uint128(std::uint8_t* buf, const std::size_t offset, const uint128_t val)
+{
+    store<std::uint64_t, order>(buf, offset, order == Order::BIG ? UINT128_HIGH(val) : UINT128_LOW(val));
+    store<std::uint64_t, order>(buf, offset + UINT64_SIZE, order == Order::BIG ? UINT128_LOW(val) : UINT128_HIGH(val));
+}
+
+/**
+ * \brief Same as store_uint128, on any kind of buffer (char, void, ...). Not constexpr.
+ */
+template<Order order>
+inline void store_uint128(void* buf, const std::size_t offset, const uint128_t val)
+{
+    store_uint128<order>(static_cast<std::uint8_t*>(buf), offset, val);
+}
+
+/**
+ * \brief Write val as a fixed point Format in 'order' at buf + offset.
+ * val is rounded to nearest even and saturated to the range of the format, NaN are written as 0.
+ * \tparam Format Fixed point format (endn::Q15, endn::Fixed<int32_t, 20>, ...)
+ * \tparam order Byte order of the buffer
+ */
+template<typename Format, Order order, typename T>
+ENDN_CONSTEXPR inline void store_fixed(std::uint8_t* buf, const std::size_t offset, const T val)
+{
+    static_assert(std::is_floating_point<T>::value, "Fixed point are written from float or double");
+    typedef typename Format::type Int;
+    store<Int, order>(buf, offset, detail::saturate_fixed<Int>(double(val) * double(std::uint64_t(1) << Format::FRACTION)));
+}
+
+/**
+ * \brief Same as store_fixed, on any kind of buffer (char, void, ...). Not constexpr.
+ */
+template<typename Format, Order order, typename T>
+inline void store_fixed(void* buf, const std::size_t offset, const T val)
+{
+    store_fixed<Format, order>(static_cast<std::uint8_t*>(buf), offset, val);
+}
+
+/**
+ * \brief Write val narrowed to IEEE binary16 in 'order' at buf + offset.
+ * \tparam order Byte order of the buffer
+ */
+template<Order order>
+ENDN_CONSTEXPR inline void store_float16(std::uint8_t* buf, const std::size_t offset, const float val)
+{
+    store<std::uint16_t, order>(buf, offset, detail::float_to_half(val));
+}
+
+/**
+ * \brief Same as store_float16, on any kind of buffer (char, void, ...). Not constexpr.
+ */
+template<Order order>
+inline void store_float16(void* buf, const std::size_t offset, const float val)
+{
+    store_float16<order>(static_cast<std::uint8_t*>(buf), offset, val);
+}
+
+/**
+ * \brief Write val narrowed to bfloat16 in 'order' at buf + offset.
+ * \tparam order Byte order of the buffer
+ */
+template<Order order>
+ENDN_CONSTEXPR inline void store_bfloat16(std::uint8_t* buf, const std::size_t offset, const float val)
+{
+    store<std::uint16_t, order>(buf, offset, detail::float_to_bfloat16(val));
+}
+
+/**
+ * \brief Same as store_bfloat16, on any kind of buffer (char, void, ...). Not constexpr.
+ */
+template<Order order>
+inline void store_bfloat16(void* buf, const std::size_t offset, const float val)
+{
+    store_bfloat16<order>(static_cast<std::uint8_t*>(buf), offset, val);
+}
+
+}
+
+#endif
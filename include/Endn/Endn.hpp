@@ -5,7 +5,43 @@
 #ifndef __ENDN_HPP__
 #define __ENDN_HPP__
 
+#include <cstddef>
 #include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#if defined(__has_include)
+#    if __has_include(<version>)
+#        include <version>
+#    endif
+#endif
+
+// C++20: GET_<TYPE>/SET_<TYPE> on std::uint8_t buffers are constexpr
+#if defined(__cpp_lib_bit_cast) && defined(__cpp_lib_endian) && defined(__cpp_lib_is_constant_evaluated)
+#    include <bit>
+#    include <type_traits>
+#    define ENDN_HAS_CONSTEXPR
+#    define ENDN_CONSTEXPR constexpr
+#    define ENDN_IS_CONSTANT_EVALUATED() std::is_constant_evaluated()
+#else
+#    define ENDN_CONSTEXPR
+#    define ENDN_IS_CONSTANT_EVALUATED() false
+#endif
+
+// Host order from the compiler when not given by CMake
+#if !defined(ENDN_IS_BIG_ENDIAN) && defined(__BYTE_ORDER__) && defined(__ORDER_BIG_ENDIAN__)
+#    if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+#        define ENDN_IS_BIG_ENDIAN
+#    endif
+#endif
+
+// Memory access of GET_<TYPE>/SET_<TYPE>, one of:
+// - ENDN_ACCESS_MEMCPY: memcpy to an integer then bswap, compiled to a single unaligned load/store without branch
+// - ENDN_ACCESS_BYTES: assemble byte by byte, for platforms where unaligned access fault or are slow
+// - ENDN_ACCESS_ALIGNED: direct access when the pointer is aligned, byte by byte otherwise (need ENDN_ENABLE_BSWAP)
+#if !defined(ENDN_ACCESS_MEMCPY) && !defined(ENDN_ACCESS_BYTES) && !defined(ENDN_ACCESS_ALIGNED)
+#    define ENDN_ACCESS_MEMCPY
+#endif
 
 namespace endn {
 
@@ -13,17 +49,23 @@ namespace endn {
 static const std::uint8_t UINT8_SIZE = 1;
 /** Size of uint16_t variable (2 bytes) */
 static const std::uint8_t UINT16_SIZE = 2;
+/** Size of uint24_t variable (3 bytes) */
+static const std::uint8_t UINT24_SIZE = 3;
 /** Size of uint32_t variable (4 bytes) */
 static const std::uint8_t UINT32_SIZE = 4;
 /** Size of uint48_t variable (6 bytes) */
 static const std::uint8_t UINT48_SIZE = 6;
 /** Size of uint64_t variable (8 bytes) */
 static const std::uint8_t UINT64_SIZE = 8;
+/** Size of uint128_t variable (16 bytes) */
+static const std::uint8_t UINT128_SIZE = 16;
 
 /** Size of int8_t variable (1 byte) */
 static const std::uint8_t INT8_SIZE = 1;
 /** Size of int16_t variable (2 bytes) */
 static const std::uint8_t INT16_SIZE = 2;
+/** Size of int24_t variable (3 bytes) */
+static const std::uint8_t INT24_SIZE = 3;
 /** Size of int32_t variable (4 bytes) */
 static const std::uint8_t INT32_SIZE = 4;
 /** Size of int48_t variable (6 bytes) */
@@ -35,6 +77,175 @@ static const std::uint8_t INT64_SIZE = 8;
 static const std::uint8_t FLOAT32_SIZE = 4;
 /** Size of double variable (8 bytes) */
 static const std::uint8_t FLOAT64_SIZE = 8;
+/** Size of IEEE binary16 variable (2 bytes) */
+static const std::uint8_t FLOAT16_SIZE = 2;
+/** Size of bfloat16 variable (2 bytes) */
+static const std::uint8_t BFLOAT16_SIZE = 2;
+
+/** Maximum number of bytes read past the end of a field by the *_PADDED functions (GET_UINT48_PADDED, ...) */
+static const std::uint8_t PADDING_SIZE = 7;
+
+/** Byte order of data in a buffer */
+enum class Order : std::uint8_t
+{
+    LITTLE,
+    BIG,
+};
+
+/** Type of a field serialized in a buffer */
+enum class Type : std::uint8_t
+{
+    UINT8,
+    INT8,
+    UINT16,
+    INT16,
+    UINT32,
+    INT32,
+    UINT48,
+    INT48,
+    UINT64,
+    INT64,
+    FLOAT32,
+    FLOAT64,
+};
+
+/**
+ * \brief Size of a type once serialized
+ * \param type Type of the field
+ * \return Size in bytes (ie UINT48_SIZE for Type::UINT48)
+ */
+inline std::uint8_t TYPE_SIZE(const Type type)
+{
+    static const std::uint8_t sizes[] = {UINT8_SIZE,
+        INT8_SIZE,
+        UINT16_SIZE,
+        INT16_SIZE,
+        UINT32_SIZE,
+        INT32_SIZE,
+        UINT48_SIZE,
+        INT48_SIZE,
+        UINT64_SIZE,
+        INT64_SIZE,
+        FLOAT32_SIZE,
+        FLOAT64_SIZE};
+    return sizes[std::size_t(type)];
+}
+
+/**
+ * \brief Fixed point (Q format) field: an Int on the wire, that hold the value multiplied by 2^Fraction.
+ * The byte order is the one of the namespace (big, little) or of the Order template parameter.
+ * \tparam Int Integer of 8, 16 or 32 bits on the wire, signed or not
+ * \tparam Fraction Number of fraction bits
+ */
+template<typename Int, unsigned Fraction>
+struct Fixed
+{
+    static_assert(std::is_integral<Int>::value && sizeof(Int) <= 4, "Fixed point integers are 8, 16 or 32 bits");
+    static_assert(Fraction <= 32, "Fixed point have at most 32 fraction bits");
+    typedef Int type;
+    static const unsigned FRACTION = Fraction;
+};
+
+/** Q15: 16 bits signed, 15 fraction bits, [-1, 1) */
+typedef Fixed<int16_t, 15> Q15;
+/** Q31: 32 bits signed, 31 fraction bits, [-1, 1) */
+typedef Fixed<int32_t, 31> Q31;
+/** Q16.16: 32 bits signed, 16 fraction bits */
+typedef Fixed<int32_t, 16> Q16_16;
+
+/**
+ * \brief Describe a host array that map to a field of fixed size records.
+ * The host array contains the host type of 'type' (std::uint64_t/int64_t for 48 bits).
+ */
+struct Column
+{
+    Type type;
+    std::size_t offset;
+    const void* data;
+};
+
+/** Byte order of the executing host */
+#ifdef ENDN_IS_BIG_ENDIAN
+static const Order HOST_ORDER = Order::BIG;
+#else
+static const Order HOST_ORDER = Order::LITTLE;
+#endif
+
+#ifdef ENDN_HAS_CONSTEXPR
+static_assert(
+    (HOST_ORDER == Order::BIG) == (std::endian::native == std::endian::big), "ENDN_IS_BIG_ENDIAN doesn't match std::endian::native");
+#endif
+
+// 128 bits integers: the compiler one when available, unless ENDN_NO_INT128 is defined
+#if defined(__SIZEOF_INT128__) && !defined(ENDN_NO_INT128)
+#    define ENDN_HAS_INT128
+#endif
+
+#ifdef ENDN_HAS_INT128
+__extension__ typedef unsigned __int128 uint128_t;
+#else
+/**
+ * \brief Portable 128 bits unsigned integer.
+ * The halves are stored in host order like a native integer, so arrays of uint128_t are swapped 16 bytes at a time.
+ */
+struct uint128_t
+{
+#    ifdef ENDN_IS_BIG_ENDIAN
+    std::uint64_t high;
+    std::uint64_t low;
+#    else
+    std::uint64_t low;
+    std::uint64_t high;
+#    endif
+};
+
+inline bool operator==(const uint128_t& a, const uint128_t& b)
+{
+    return a.high == b.high && a.low == b.low;
+}
+inline bool operator!=(const uint128_t& a, const uint128_t& b)
+{
+    return !(a == b);
+}
+#endif
+
+/**
+ * \brief Build a uint128_t from its 64 msb and 64 lsb
+ */
+constexpr uint128_t MAKE_UINT128(const std::uint64_t high, const std::uint64_t low)
+{
+#ifdef ENDN_HAS_INT128
+    return (uint128_t(high) << 64) | low;
+#elif defined(ENDN_IS_BIG_ENDIAN)
+    return uint128_t {high, low};
+#else
+    return uint128_t {low, high};
+#endif
+}
+
+/**
+ * \brief 64 msb of a uint128_t
+ */
+constexpr std::uint64_t UINT128_HIGH(const uint128_t val)
+{
+#ifdef ENDN_HAS_INT128
+    return std::uint64_t(val >> 64);
+#else
+    return val.high;
+#endif
+}
+
+/**
+ * \brief 64 lsb of a uint128_t
+ */
+constexpr std::uint64_t UINT128_LOW(const uint128_t val)
+{
+#ifdef ENDN_HAS_INT128
+    return std::uint64_t(val);
+#else
+    return val.low;
+#endif
+}
 
 inline bool IS_16_ALIGNED(const std::uintptr_t ptr)
 {
@@ -62,6 +273,36 @@ inline bool IS_64_ALIGNED(const std::uint8_t* ptr)
     return IS_64_ALIGNED(std::uintptr_t(ptr));
 }
 
+namespace detail {
+
+/**
+ * \brief Reinterpret the bytes of from as To, without strict aliasing violation.
+ * Compilers turn the memcpy into a register move.
+ */
+template<typename To, typename From>
+ENDN_CONSTEXPR inline To bit_cast(const From& from)
+{
+    static_assert(sizeof(To) == sizeof(From), "bit_cast require types of the same size");
+#ifdef ENDN_HAS_CONSTEXPR
+    return std::bit_cast<To>(from);
+#else
+    To to;
+    std::memcpy(&to, &from, sizeof(To));
+    return to;
+#endif
+}
+
+/**
+ * \brief Sign extend the 48 lsb of value. Branchless: the sign bit is flipped then subtracted.
+ */
+ENDN_CONSTEXPR inline std::int64_t sign_extend48(const std::uint64_t value)
+{
+    const std::uint64_t sign = std::uint64_t(1) << 47;
+    return bit_cast<std::int64_t>(((value & 0xFFFFFFFFFFFFull) ^ sign) - sign);
+}
+
+}
+
 inline bool OVERLAP(const std::uintptr_t ptr1, const std::uintptr_t ptr2, const std::uint64_t count)
 {
     return (ptr1 <= ptr2 && ptr1 + count > ptr2) || (ptr2 <= ptr1 && ptr2 + count > ptr1);
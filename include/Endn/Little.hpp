@@ -11,7 +11,8 @@
 
 // Library Headers
 #include <Endn/Endn.hpp>
-#include <Endn/Helpers.hpp>
+#include <Endn/Core.hpp>
+#include <Endn/Simd.hpp>
 
 // C++ Headers
 #include <cstdint>
@@ -34,9 +35,9 @@ namespace little {
  * \param buf Pointer to the std::uint8_t
  * \return The deserialized data
  */
-inline std::uint8_t GET_UINT8(const std::uint8_t* buf)
+ENDN_CONSTEXPR inline std::uint8_t GET_UINT8(const std::uint8_t* buf)
 {
-    return ((std::uint8_t)buf[0]);
+    return load<std::uint8_t, Order::LITTLE>(buf);
 }
 
 /**
@@ -44,18 +45,20 @@ inline std::uint8_t GET_UINT8(const std::uint8_t* buf)
  * \param buf Pointer to the std::uint16_t
  * \return The deserialized data
  */
-inline std::uint16_t GET_UINT16(const std::uint8_t* buf)
+ENDN_CONSTEXPR inline std::uint16_t GET_UINT16(const std::uint8_t* buf)
 {
-#ifdef ENDN_ENABLE_BSWAP
-#    ifdef ENDN_IS_BIG_ENDIAN
-    if(IS_16_ALIGNED(std::uintptr_t(buf)))
-        return bswap_16(*reinterpret_cast<const std::uint16_t*>(buf));
-#    else
-    if(IS_16_ALIGNED(std::uintptr_t(buf)))
-        return std::uint16_t(*(const std::uint16_t*)(buf));
-#    endif
-#endif
-    return ((std::uint16_t)buf[1] << 8) | ((std::uint16_t)buf[0]);
+    return load<std::uint16_t, Order::LITTLE>(buf);
+}
+
+/**
+ * \brief Deserialize an std::uint24_t from buffer.
+ * \note It is return on a std::uint32_t for convenience
+ * \param buf Pointer to the std::uint24_t
+ * \return The deserialized data
+ */
+ENDN_CONSTEXPR inline std::uint32_t GET_UINT24(const std::uint8_t* buf)
+{
+    return load<std::uint32_t, Order::LITTLE, UINT24_SIZE>(buf);
 }
 
 /**
@@ -63,18 +66,9 @@ inline std::uint16_t GET_UINT16(const std::uint8_t* buf)
  * \param buf Pointer to the std::uint32_t
  * \return The deserialized data
  */
-inline std::uint32_t GET_UINT32(const std::uint8_t* buf)
+ENDN_CONSTEXPR inline std::uint32_t GET_UINT32(const std::uint8_t* buf)
 {
-#ifdef ENDN_ENABLE_BSWAP
-#    ifdef ENDN_IS_BIG_ENDIAN
-    if(IS_32_ALIGNED(std::uintptr_t(buf)))
-        return bswap_32(*reinterpret_cast<const std::uint32_t*>(buf));
-#    else
-    if(IS_32_ALIGNED(std::uintptr_t(buf)))
-        return std::uint32_t(*(const std::uint32_t*)(buf));
-#    endif
-#endif
-    return ((std::uint32_t)buf[3] << 24) | ((std::uint32_t)buf[2] << 16) | ((std::uint32_t)buf[1] << 8) | ((std::uint32_t)buf[0]);
+    return load<std::uint32_t, Order::LITTLE>(buf);
 }
 
 /**
@@ -83,19 +77,9 @@ inline std::uint32_t GET_UINT32(const std::uint8_t* buf)
  * \param buf Pointer to the std::uint48_t
  * \return The deserialized data
  */
-inline std::uint64_t GET_UINT48(const std::uint8_t* buf)
+ENDN_CONSTEXPR inline std::uint64_t GET_UINT48(const std::uint8_t* buf)
 {
-#ifdef ENDN_ENABLE_BSWAP
-#    ifdef ENDN_IS_BIG_ENDIAN
-    if(IS_64_ALIGNED(std::uintptr_t(buf)))
-        return bswap_64(*reinterpret_cast<const std::uint64_t*>(buf) << 16) & std::uint64_t(0x0000FFFFFFFFFFFF);
-#    else
-    if(IS_64_ALIGNED(std::uintptr_t(buf)))
-        return std::uint64_t(*(const std::uint64_t*)(buf)) & std::uint64_t(0xFFFFFFFFFFFF);
-#    endif
-#endif
-    return ((std::uint64_t)buf[5] << 40) | ((std::uint64_t)buf[4] << 32) | ((std::uint64_t)buf[3] << 24) | ((std::uint64_t)buf[2] << 16)
-           | ((std::uint64_t)buf[1] << 8) | ((std::uint64_t)buf[0]);
+    return load<std::uint64_t, Order::LITTLE, UINT48_SIZE>(buf);
 }
 
 /**
@@ -103,19 +87,19 @@ inline std::uint64_t GET_UINT48(const std::uint8_t* buf)
  * \param buf Pointer to the std::uint64_t
  * \return The deserialized data
  */
-inline std::uint64_t GET_UINT64(const std::uint8_t* buf)
+ENDN_CONSTEXPR inline std::uint64_t GET_UINT64(const std::uint8_t* buf)
 {
-#ifdef ENDN_ENABLE_BSWAP
-#    ifdef ENDN_IS_BIG_ENDIAN
-    if(IS_64_ALIGNED(std::uintptr_t(buf)))
-        return bswap_64(*reinterpret_cast<const std::uint64_t*>(buf));
-#    else
-    if(IS_64_ALIGNED(std::uintptr_t(buf)))
-        return std::uint64_t(*(const std::uint64_t*)(buf));
-#    endif
-#endif
-    return ((std::uint64_t)buf[7] << 56) | ((std::uint64_t)buf[6] << 48) | ((std::uint64_t)buf[5] << 40) | ((std::uint64_t)buf[4] << 32)
-           | ((std::uint64_t)buf[3] << 24) | ((std::uint64_t)buf[2] << 16) | ((std::uint64_t)buf[1] << 8) | ((std::uint64_t)buf[0]);
+    return load<std::uint64_t, Order::LITTLE>(buf);
+}
+
+/**
+ * \brief Deserialize an uint128_t from buffer
+ * \param buf Pointer to the uint128_t
+ * \return The deserialized data
+ */
+ENDN_CONSTEXPR inline uint128_t GET_UINT128(const std::uint8_t* buf)
+{
+    return load_uint128<Order::LITTLE>(buf);
 }
 
 /**
@@ -123,10 +107,9 @@ inline std::uint64_t GET_UINT64(const std::uint8_t* buf)
  * \param buf Pointer to the int8_t
  * \return The deserialized data
  */
-inline int8_t GET_INT8(const std::uint8_t* buf)
+ENDN_CONSTEXPR inline int8_t GET_INT8(const std::uint8_t* buf)
 {
-    const std::uint8_t value = GET_UINT8(buf);
-    return *(int8_t*)(&value);
+    return load<int8_t, Order::LITTLE>(buf);
 }
 
 /**
@@ -134,10 +117,20 @@ inline int8_t GET_INT8(const std::uint8_t* buf)
  * \param buf Pointer to the int16_t
  * \return The deserialized data
  */
-inline int16_t GET_INT16(const std::uint8_t* buf)
+ENDN_CONSTEXPR inline int16_t GET_INT16(const std::uint8_t* buf)
 {
-    const std::uint8_t value = GET_UINT8(buf);
-    return *(int16_t*)(&value);
+    return load<int16_t, Order::LITTLE>(buf);
+}
+
+/**
+ * \brief Deserialize an int24_t from buffer.
+ * \note It is return on a int32_t for convenience
+ * \param buf Pointer to the std::uint24_t
+ * \return The deserialized data
+ */
+ENDN_CONSTEXPR inline int32_t GET_INT24(const std::uint8_t* buf)
+{
+    return load<int32_t, Order::LITTLE, INT24_SIZE>(buf);
 }
 
 /**
@@ -145,10 +138,9 @@ inline int16_t GET_INT16(const std::uint8_t* buf)
  * \param buf Pointer to the int32_t
  * \return The deserialized data
  */
-inline int32_t GET_INT32(const std::uint8_t* buf)
+ENDN_CONSTEXPR inline int32_t GET_INT32(const std::uint8_t* buf)
 {
-    const std::uint8_t value = GET_UINT8(buf);
-    return *(int32_t*)(&value);
+    return load<int32_t, Order::LITTLE>(buf);
 }
 
 /**
@@ -157,10 +149,9 @@ inline int32_t GET_INT32(const std::uint8_t* buf)
  * \param buf Pointer to the std::uint48_t
  * \return The deserialized data
  */
-inline int64_t GET_INT48(const std::uint8_t* buf)
+ENDN_CONSTEXPR inline int64_t GET_INT48(const std::uint8_t* buf)
 {
-    const std::uint8_t value = GET_UINT8(buf);
-    return *(int64_t*)(&value);
+    return load<int64_t, Order::LITTLE, INT48_SIZE>(buf);
 }
 
 /**
@@ -168,10 +159,9 @@ inline int64_t GET_INT48(const std::uint8_t* buf)
  * \param buf Pointer to the int64_t
  * \return The deserialized data
  */
-inline int64_t GET_INT64(const std::uint8_t* buf)
+ENDN_CONSTEXPR inline int64_t GET_INT64(const std::uint8_t* buf)
 {
-    const std::uint8_t value = GET_UINT8(buf);
-    return *(int64_t*)(&value);
+    return load<int64_t, Order::LITTLE>(buf);
 }
 
 /**
@@ -179,10 +169,29 @@ inline int64_t GET_INT64(const std::uint8_t* buf)
  * \param buf Pointer to the float
  * \return The deserialized data
  */
-inline float GET_FLOAT32(const std::uint8_t* buf)
+ENDN_CONSTEXPR inline float GET_FLOAT32(const std::uint8_t* buf)
+{
+    return load<float, Order::LITTLE>(buf);
+}
+
+/**
+ * \brief Deserialize a binary16 float from buffer
+ * \param buf Pointer to the binary16 float
+ * \return The deserialized data
+ */
+ENDN_CONSTEXPR inline float GET_FLOAT16(const std::uint8_t* buf)
+{
+    return load_float16<Order::LITTLE>(buf);
+}
+
+/**
+ * \brief Deserialize a bfloat16 from buffer
+ * \param buf Pointer to the bfloat16
+ * \return The deserialized data
+ */
+ENDN_CONSTEXPR inline float GET_BFLOAT16(const std::uint8_t* buf)
 {
-    const std::uint32_t value = GET_UINT32(buf);
-    return *(float*)(&value);
+    return load_bfloat16<Order::LITTLE>(buf);
 }
 
 /**
@@ -190,10 +199,9 @@ inline float GET_FLOAT32(const std::uint8_t* buf)
  * \param buf Pointer to the double
  * \return The deserialized data
  */
-inline double GET_FLOAT64(const std::uint8_t* buf)
+ENDN_CONSTEXPR inline double GET_FLOAT64(const std::uint8_t* buf)
 {
-    const std::uint64_t value = GET_UINT64(buf);
-    return *(double*)(&value);
+    return load<double, Order::LITTLE>(buf);
 }
 
 /**
@@ -202,9 +210,9 @@ inline double GET_FLOAT64(const std::uint8_t* buf)
  * \param offset Offset in the buffer to access to an std::uint8_t* (in bytes)
  * \return The deserialized data
  */
-inline std::uint8_t GET_UINT8(const std::uint8_t* buf, const std::size_t offset)
+ENDN_CONSTEXPR inline std::uint8_t GET_UINT8(const std::uint8_t* buf, const std::size_t offset)
 {
-    return GET_UINT8(&buf[offset]);
+    return load<std::uint8_t, Order::LITTLE>(buf, offset);
 }
 
 /**
@@ -213,9 +221,21 @@ inline std::uint8_t GET_UINT8(const std::uint8_t* buf, const std::size_t offset)
  * \param offset Offset in the buffer to access to an std::uint16_t* (in bytes)
  * \return The deserialized data
  */
-inline std::uint16_t GET_UINT16(const std::uint8_t* buf, const std::size_t offset)
+ENDN_CONSTEXPR inline std::uint16_t GET_UINT16(const std::uint8_t* buf, const std::size_t offset)
+{
+    return load<std::uint16_t, Order::LITTLE>(buf, offset);
+}
+
+/**
+ * \brief Deserialize an std::uint24_t from buffer
+ * \param buf Pointer to the buffer
+ * \param offset Offset in the buffer to access to an std::uint24_t* (in bytes)
+ * \note Store in a std::uint32_t for convenience
+ * \return The deserialized data
+ */
+ENDN_CONSTEXPR inline std::uint32_t GET_UINT24(const std::uint8_t* buf, const std::size_t offset)
 {
-    return GET_UINT16(&buf[offset]);
+    return load<std::uint32_t, Order::LITTLE, UINT24_SIZE>(buf, offset);
 }
 
 /**
@@ -224,9 +244,9 @@ inline std::uint16_t GET_UINT16(const std::uint8_t* buf, const std::size_t offse
  * \param offset Offset in the buffer to access to an std::uint32_t* (in bytes)
  * \return The deserialized data
  */
-inline std::uint32_t GET_UINT32(const std::uint8_t* buf, const std::size_t offset)
+ENDN_CONSTEXPR inline std::uint32_t GET_UINT32(const std::uint8_t* buf, const std::size_t offset)
 {
-    return GET_UINT32(&buf[offset]);
+    return load<std::uint32_t, Order::LITTLE>(buf, offset);
 }
 
 /**
@@ -236,9 +256,9 @@ inline std::uint32_t GET_UINT32(const std::uint8_t* buf, const std::size_t offse
  * \note Store in a std::uint64_t for convenience
  * \return The deserialized data
  */
-inline std::uint64_t GET_UINT48(const std::uint8_t* buf, const std::size_t offset)
+ENDN_CONSTEXPR inline std::uint64_t GET_UINT48(const std::uint8_t* buf, const std::size_t offset)
 {
-    return GET_UINT48(&buf[offset]);
+    return load<std::uint64_t, Order::LITTLE, UINT48_SIZE>(buf, offset);
 }
 
 /**
@@ -247,9 +267,20 @@ inline std::uint64_t GET_UINT48(const std::uint8_t* buf, const std::size_t offse
  * \param offset Offset in the buffer to access to an std::uint64_t* (in bytes)
  * \return The deserialized data
  */
-inline std::uint64_t GET_UINT64(const std::uint8_t* buf, const std::size_t offset)
+ENDN_CONSTEXPR inline std::uint64_t GET_UINT64(const std::uint8_t* buf, const std::size_t offset)
+{
+    return load<std::uint64_t, Order::LITTLE>(buf, offset);
+}
+
+/**
+ * \brief Deserialize an uint128_t from buffer
+ * \param buf Pointer to the buffer
+ * \param offset Offset in the buffer to access to an uint128_t* (in bytes)
+ * \return The deserialized data
+ */
+ENDN_CONSTEXPR inline uint128_t GET_UINT128(const std::uint8_t* buf, const std::size_t offset)
 {
-    return GET_UINT64(&buf[offset]);
+    return load_uint128<Order::LITTLE>(buf, offset);
 }
 
 /**
@@ -258,9 +289,9 @@ inline std::uint64_t GET_UINT64(const std::uint8_t* buf, const std::size_t offse
  * \param offset Offset in the buffer to access to an int8_t* (in bytes)
  * \return The deserialized data
  */
-inline int8_t GET_INT8(const std::uint8_t* buf, const std::size_t offset)
+ENDN_CONSTEXPR inline int8_t GET_INT8(const std::uint8_t* buf, const std::size_t offset)
 {
-    return GET_INT8(&buf[offset]);
+    return load<int8_t, Order::LITTLE>(buf, offset);
 }
 
 /**
@@ -269,9 +300,21 @@ inline int8_t GET_INT8(const std::uint8_t* buf, const std::size_t offset)
  * \param offset Offset in the buffer to access to an int16_t* (in bytes)
  * \return The deserialized data
  */
-inline int16_t GET_INT16(const std::uint8_t* buf, const std::size_t offset)
+ENDN_CONSTEXPR inline int16_t GET_INT16(const std::uint8_t* buf, const std::size_t offset)
 {
-    return GET_INT16(&buf[offset]);
+    return load<int16_t, Order::LITTLE>(buf, offset);
+}
+
+/**
+ * \brief Deserialize an int24_t from buffer
+ * \param buf Pointer to the buffer
+ * \param offset Offset in the buffer to access to an int24_t* (in bytes)
+ * \note Store in a int32_t for convenience
+ * \return The deserialized data
+ */
+ENDN_CONSTEXPR inline int32_t GET_INT24(const std::uint8_t* buf, const std::size_t offset)
+{
+    return load<int32_t, Order::LITTLE, INT24_SIZE>(buf, offset);
 }
 
 /**
@@ -280,9 +323,9 @@ inline int16_t GET_INT16(const std::uint8_t* buf, const std::size_t offset)
  * \param offset Offset in the buffer to access to an int32_t* (in bytes)
  * \return The deserialized data
  */
-inline int32_t GET_INT32(const std::uint8_t* buf, const std::size_t offset)
+ENDN_CONSTEXPR inline int32_t GET_INT32(const std::uint8_t* buf, const std::size_t offset)
 {
-    return GET_INT32(&buf[offset]);
+    return load<int32_t, Order::LITTLE>(buf, offset);
 }
 
 /**
@@ -292,9 +335,9 @@ inline int32_t GET_INT32(const std::uint8_t* buf, const std::size_t offset)
  * \note Store in a int64_t for convenience
  * \return The deserialized data
  */
-inline int64_t GET_INT48(const std::uint8_t* buf, const std::size_t offset)
+ENDN_CONSTEXPR inline int64_t GET_INT48(const std::uint8_t* buf, const std::size_t offset)
 {
-    return GET_INT48(&buf[offset]);
+    return load<int64_t, Order::LITTLE, INT48_SIZE>(buf, offset);
 }
 
 /**
@@ -303,9 +346,9 @@ inline int64_t GET_INT48(const std::uint8_t* buf, const std::size_t offset)
  * \param offset Offset in the buffer to access to an int64_t* (in bytes)
  * \return The deserialized data
  */
-inline int64_t GET_INT64(const std::uint8_t* buf, const std::size_t offset)
+ENDN_CONSTEXPR inline int64_t GET_INT64(const std::uint8_t* buf, const std::size_t offset)
 {
-    return GET_INT64(&buf[offset]);
+    return load<int64_t, Order::LITTLE>(buf, offset);
 }
 
 /**
@@ -314,9 +357,31 @@ inline int64_t GET_INT64(const std::uint8_t* buf, const std::size_t offset)
  * \param offset Offset in the buffer to access to an float* (in bytes)
  * \return The deserialized data
  */
-inline float GET_FLOAT32(const std::uint8_t* buf, const std::size_t offset)
+ENDN_CONSTEXPR inline float GET_FLOAT32(const std::uint8_t* buf, const std::size_t offset)
+{
+    return load<float, Order::LITTLE>(buf, offset);
+}
+
+/**
+ * \brief Deserialize a binary16 float from buffer
+ * \param buf Pointer to the buffer
+ * \param offset Offset in the buffer to access to a binary16 float (in bytes)
+ * \return The deserialized data
+ */
+ENDN_CONSTEXPR inline float GET_FLOAT16(const std::uint8_t* buf, const std::size_t offset)
+{
+    return load_float16<Order::LITTLE>(buf, offset);
+}
+
+/**
+ * \brief Deserialize a bfloat16 from buffer
+ * \param buf Pointer to the buffer
+ * \param offset Offset in the buffer to access to a bfloat16 (in bytes)
+ * \return The deserialized data
+ */
+ENDN_CONSTEXPR inline float GET_BFLOAT16(const std::uint8_t* buf, const std::size_t offset)
 {
-    return GET_FLOAT32(&buf[offset]);
+    return load_bfloat16<Order::LITTLE>(buf, offset);
 }
 
 /**
@@ -325,813 +390,3039 @@ inline float GET_FLOAT32(const std::uint8_t* buf, const std::size_t offset)
  * \param offset Offset in the buffer to access to an double  (in bytes)
  * \return The deserialized data
  */
-inline double GET_FLOAT64(const std::uint8_t* buf, const std::size_t offset)
+ENDN_CONSTEXPR inline double GET_FLOAT64(const std::uint8_t* buf, const std::size_t offset)
 {
-    return GET_FLOAT64(&buf[offset]);
+    return load<double, Order::LITTLE>(buf, offset);
 }
 
 /**
- * \brief Serialize a std::uint8_t in the buffer
+ * \brief Deserialize an std::uint24_t from a padded buffer, with a single 4 bytes load whatever the alignment
+ * \param buf Pointer to the std::uint24_t, followed by at least 1 readable byte
+ * \return The deserialized data
+ */
+ENDN_CONSTEXPR inline std::uint32_t GET_UINT24_PADDED(const std::uint8_t* buf)
+{
+    return load_padded<std::uint32_t, Order::LITTLE, UINT24_SIZE>(buf);
+}
+
+/**
+ * \brief Deserialize an std::uint48_t from a padded buffer, with a single 8 bytes load whatever the alignment
+ * \param buf Pointer to the std::uint48_t, followed by at least 2 readable bytes
+ * \return The deserialized data
+ */
+ENDN_CONSTEXPR inline std::uint64_t GET_UINT48_PADDED(const std::uint8_t* buf)
+{
+    return load_padded<std::uint64_t, Order::LITTLE, UINT48_SIZE>(buf);
+}
+
+/**
+ * \brief Deserialize an std::uint24_t from a padded buffer, with a single 4 bytes load whatever the alignment
+ * \param buf Pointer to the buffer, at least 1 byte must be readable after the std::uint24_t
+ * \param offset Offset in the buffer to access to an std::uint24_t (in bytes)
+ * \return The deserialized data
+ */
+ENDN_CONSTEXPR inline std::uint32_t GET_UINT24_PADDED(const std::uint8_t* buf, const std::size_t offset)
+{
+    return load_padded<std::uint32_t, Order::LITTLE, UINT24_SIZE>(buf, offset);
+}
+
+/**
+ * \brief Deserialize an std::uint48_t from a padded buffer, with a single 8 bytes load whatever the alignment
+ * \param buf Pointer to the buffer, at least 2 bytes must be readable after the std::uint48_t
+ * \param offset Offset in the buffer to access to an std::uint48_t (in bytes)
+ * \return The deserialized data
+ */
+ENDN_CONSTEXPR inline std::uint64_t GET_UINT48_PADDED(const std::uint8_t* buf, const std::size_t offset)
+{
+    return load_padded<std::uint64_t, Order::LITTLE, UINT48_SIZE>(buf, offset);
+}
+
+/**
+ * \brief Deserialize an int24_t from a padded buffer, with a single 4 bytes load whatever the alignment
+ * \param buf Pointer to the int24_t, followed by at least 1 readable byte
+ * \return The deserialized data
+ */
+ENDN_CONSTEXPR inline int32_t GET_INT24_PADDED(const std::uint8_t* buf)
+{
+    return load_padded<int32_t, Order::LITTLE, INT24_SIZE>(buf);
+}
+
+/**
+ * \brief Deserialize an int48_t from a padded buffer, with a single 8 bytes load whatever the alignment
+ * \param buf Pointer to the int48_t, followed by at least 2 readable bytes
+ * \return The deserialized data
+ */
+ENDN_CONSTEXPR inline int64_t GET_INT48_PADDED(const std::uint8_t* buf)
+{
+    return load_padded<int64_t, Order::LITTLE, INT48_SIZE>(buf);
+}
+
+/**
+ * \brief Deserialize an int24_t from a padded buffer, with a single 4 bytes load whatever the alignment
+ * \param buf Pointer to the buffer, at least 1 byte must be readable after the int24_t
+ * \param offset Offset in the buffer to access to an int24_t (in bytes)
+ * \return The deserialized data
+ */
+ENDN_CONSTEXPR inline int32_t GET_INT24_PADDED(const std::uint8_t* buf, const std::size_t offset)
+{
+    return load_padded<int32_t, Order::LITTLE, INT24_SIZE>(buf, offset);
+}
+
+/**
+ * \brief Deserialize an int48_t from a padded buffer, with a single 8 bytes load whatever the alignment
+ * \param buf Pointer to the buffer, at least 2 bytes must be readable after the int48_t
+ * \param offset Offset in the buffer to access to an int48_t (in bytes)
+ * \return The deserialized data
+ */
+ENDN_CONSTEXPR inline int64_t GET_INT48_PADDED(const std::uint8_t* buf, const std::size_t offset)
+{
+    return load_padded<int64_t, Order::LITTLE, INT48_SIZE>(buf, offset);
+}
+
+/**
+ * \brief Deserialize an unsigned integer of size bytes, known at runtime
+ * \param buf Pointer to the integer
+ * \param size Size of the integer, from 1 to 8 bytes
+ * \return The deserialized data
+ */
+ENDN_CONSTEXPR inline std::uint64_t GET_UINTN(const std::uint8_t* buf, const std::size_t size)
+{
+    return detail::load_var<Order::LITTLE>(buf, size);
+}
+
+/**
+ * \brief Deserialize an unsigned integer of size bytes, known at runtime
  * \param buf Pointer to the buffer
- * \param val Value to serialize
+ * \param offset Offset in the buffer to access to the integer (in bytes)
+ * \param size Size of the integer, from 1 to 8 bytes
+ * \return The deserialized data
  */
-inline void SET_UINT8(std::uint8_t* buf, const std::uint8_t val)
+ENDN_CONSTEXPR inline std::uint64_t GET_UINTN(const std::uint8_t* buf, const std::size_t offset, const std::size_t size)
 {
-    buf[0] = (std::uint8_t)(val & 0xFF);
+    return detail::load_var<Order::LITTLE>(buf + offset, size);
 }
 
 /**
- * \brief Serialize a std::uint16_t in the buffer
+ * \brief Deserialize a signed integer of size bytes, known at runtime. The value is sign extended
+ * \param buf Pointer to the integer
+ * \param size Size of the integer, from 1 to 8 bytes
+ * \return The deserialized data
+ */
+ENDN_CONSTEXPR inline int64_t GET_INTN(const std::uint8_t* buf, const std::size_t size)
+{
+    return detail::sign_extend_var(detail::load_var<Order::LITTLE>(buf, size), size);
+}
+
+/**
+ * \brief Deserialize a signed integer of size bytes, known at runtime. The value is sign extended
  * \param buf Pointer to the buffer
- * \param val Value to serialize
+ * \param offset Offset in the buffer to access to the integer (in bytes)
+ * \param size Size of the integer, from 1 to 8 bytes
+ * \return The deserialized data
  */
-inline void SET_UINT16(std::uint8_t* buf, const std::uint16_t val)
+ENDN_CONSTEXPR inline int64_t GET_INTN(const std::uint8_t* buf, const std::size_t offset, const std::size_t size)
 {
-#ifdef ENDN_ENABLE_BSWAP
-#    ifdef ENDN_IS_BIG_ENDIAN
-    if(IS_16_ALIGNED(std::uintptr_t(buf)))
-    {
-        (*(std::uint16_t*)buf) = bswap_16(val);
-        return;
-    }
-#    else
-    if(IS_16_ALIGNED(std::uintptr_t(buf)))
-    {
-        (*(std::uint16_t*)buf) = val;
-        return;
-    }
-#    endif
-#endif
-    buf[1] = (std::uint8_t)((val >> 8) & 0xFF);
-    buf[0] = (std::uint8_t)(val & 0xFF);
+    return detail::sign_extend_var(detail::load_var<Order::LITTLE>(buf + offset, size), size);
 }
 
 /**
- * \brief Serialize a std::uint32_t in the buffer
+ * \brief Deserialize an unsigned integer of size bytes from a padded buffer, with a single 8 bytes load and no branch
+ * \param buf Pointer to the integer, followed by at least 8 - size readable bytes
+ * \param size Size of the integer, from 1 to 8 bytes
+ * \return The deserialized data
+ */
+ENDN_CONSTEXPR inline std::uint64_t GET_UINTN_PADDED(const std::uint8_t* buf, const std::size_t size)
+{
+    return detail::load_var_padded<Order::LITTLE>(buf, size);
+}
+
+/**
+ * \brief Deserialize an unsigned integer of size bytes from a padded buffer, with a single 8 bytes load and no branch
+ * \param buf Pointer to the buffer, at least 8 - size bytes must be readable after the integer
+ * \param offset Offset in the buffer to access to the integer (in bytes)
+ * \param size Size of the integer, from 1 to 8 bytes
+ * \return The deserialized data
+ */
+ENDN_CONSTEXPR inline std::uint64_t GET_UINTN_PADDED(const std::uint8_t* buf, const std::size_t offset, const std::size_t size)
+{
+    return detail::load_var_padded<Order::LITTLE>(buf + offset, size);
+}
+
+/**
+ * \brief Deserialize a signed integer of size bytes from a padded buffer, with a single 8 bytes load and no branch
+ * \param buf Pointer to the integer, followed by at least 8 - size readable bytes
+ * \param size Size of the integer, from 1 to 8 bytes
+ * \return The deserialized data
+ */
+ENDN_CONSTEXPR inline int64_t GET_INTN_PADDED(const std::uint8_t* buf, const std::size_t size)
+{
+    return detail::sign_extend_var(detail::load_var_padded<Order::LITTLE>(buf, size), size);
+}
+
+/**
+ * \brief Deserialize a signed integer of size bytes from a padded buffer, with a single 8 bytes load and no branch
+ * \param buf Pointer to the buffer, at least 8 - size bytes must be readable after the integer
+ * \param offset Offset in the buffer to access to the integer (in bytes)
+ * \param size Size of the integer, from 1 to 8 bytes
+ * \return The deserialized data
+ */
+ENDN_CONSTEXPR inline int64_t GET_INTN_PADDED(const std::uint8_t* buf, const std::size_t offset, const std::size_t size)
+{
+    return detail::sign_extend_var(detail::load_var_padded<Order::LITTLE>(buf + offset, size), size);
+}
+
+/**
+ * \brief Serialize the size low bytes of an unsigned integer, size being known at runtime
  * \param buf Pointer to the buffer
  * \param val Value to serialize
+ * \param size Number of bytes to write, from 1 to 8
  */
-inline void SET_UINT32(std::uint8_t* buf, const std::uint32_t val)
+ENDN_CONSTEXPR inline void SET_UINTN(std::uint8_t* buf, const std::uint64_t val, const std::size_t size)
 {
-#ifdef ENDN_ENABLE_BSWAP
-#    ifdef ENDN_IS_BIG_ENDIAN
-    if(IS_32_ALIGNED(std::uintptr_t(buf)))
-    {
-        (*(std::uint32_t*)buf) = bswap_32(val);
-        return;
-    }
-#    else
-    if(IS_32_ALIGNED(std::uintptr_t(buf)))
-    {
-        (*(std::uint32_t*)buf) = val;
-        return;
-    }
-#    endif
-#endif
-    buf[3] = (std::uint8_t)((val >> 24) & 0xFF);
-    buf[2] = (std::uint8_t)((val >> 16) & 0xFF);
-    buf[1] = (std::uint8_t)((val >> 8) & 0xFF);
-    buf[0] = (std::uint8_t)(val & 0xFF);
+    detail::store_var<Order::LITTLE>(buf, val, size);
 }
 
 /**
- * \brief Serialize a std::uint48_t in the buffer
+ * \brief Serialize the size low bytes of an unsigned integer, size being known at runtime
  * \param buf Pointer to the buffer
+ * \param offset Offset in the buffer where to write the integer (in bytes)
  * \param val Value to serialize
- * \note For convenience the std::uint48 is stored into a std::uint64_t
+ * \param size Number of bytes to write, from 1 to 8
  */
-inline void SET_UINT48(std::uint8_t* buf, const std::uint64_t val)
+ENDN_CONSTEXPR inline void SET_UINTN(std::uint8_t* buf, const std::size_t offset, const std::uint64_t val, const std::size_t size)
 {
-    buf[5] = (std::uint8_t)((val >> 40) & 0xFF);
-    buf[4] = (std::uint8_t)((val >> 32) & 0xFF);
-    buf[3] = (std::uint8_t)((val >> 24) & 0xFF);
-    buf[2] = (std::uint8_t)((val >> 16) & 0xFF);
-    buf[1] = (std::uint8_t)((val >> 8) & 0xFF);
-    buf[0] = (std::uint8_t)(val & 0xFF);
+    detail::store_var<Order::LITTLE>(buf + offset, val, size);
 }
 
 /**
- * \brief Serialize a std::uint64_t in the buffer
+ * \brief Serialize the size low bytes of an unsigned integer, size being known at runtime
  * \param buf Pointer to the buffer
+ * \param offset Offset in the buffer where to write the integer (in bytes)
  * \param val Value to serialize
+ * \param size Number of bytes to write, from 1 to 8
+ * \param length Auto Increment this variable by size
  */
-inline void SET_UINT64(std::uint8_t* buf, const std::uint64_t val)
+ENDN_CONSTEXPR inline void SET_UINTN(
+    std::uint8_t* buf, const std::size_t offset, const std::uint64_t val, const std::size_t size, std::size_t& length)
 {
-#ifdef ENDN_ENABLE_BSWAP
-#    ifdef ENDN_IS_BIG_ENDIAN
-    if(IS_64_ALIGNED(std::uintptr_t(buf)))
-    {
-        (*(std::uint64_t*)buf) = bswap_64(val);
-        return;
-    }
-#    else
-    if(IS_64_ALIGNED(std::uintptr_t(buf)))
-    {
-        (*(std::uint64_t*)buf) = val;
-        return;
-    }
-#    endif
-#endif
-    buf[7] = (std::uint8_t)((val >> 56) & 0xFF);
-    buf[6] = (std::uint8_t)((val >> 48) & 0xFF);
-    buf[5] = (std::uint8_t)((val >> 40) & 0xFF);
-    buf[4] = (std::uint8_t)((val >> 32) & 0xFF);
-    buf[3] = (std::uint8_t)((val >> 24) & 0xFF);
-    buf[2] = (std::uint8_t)((val >> 16) & 0xFF);
-    buf[1] = (std::uint8_t)((val >> 8) & 0xFF);
-    buf[0] = (std::uint8_t)(val & 0xFF);
+    detail::store_var<Order::LITTLE>(buf + offset, val, size);
+    length += size;
 }
 
 /**
- * \brief Serialize a int8_t in the buffer
+ * \brief Serialize the size low bytes of a signed integer, size being known at runtime
  * \param buf Pointer to the buffer
  * \param val Value to serialize
+ * \param size Number of bytes to write, from 1 to 8
  */
-inline void SET_INT8(std::uint8_t* buf, const int8_t val)
+ENDN_CONSTEXPR inline void SET_INTN(std::uint8_t* buf, const int64_t val, const std::size_t size)
 {
-    SET_UINT8(buf, *(const std::uint8_t*)&val);
+    detail::store_var<Order::LITTLE>(buf, std::uint64_t(val), size);
 }
 
 /**
- * \brief Serialize a int16_t in the buffer
+ * \brief Serialize the size low bytes of a signed integer, size being known at runtime
  * \param buf Pointer to the buffer
+ * \param offset Offset in the buffer where to write the integer (in bytes)
  * \param val Value to serialize
+ * \param size Number of bytes to write, from 1 to 8
  */
-inline void SET_INT16(std::uint8_t* buf, const int16_t val)
+ENDN_CONSTEXPR inline void SET_INTN(std::uint8_t* buf, const std::size_t offset, const int64_t val, const std::size_t size)
 {
-    SET_UINT16(buf, *(const std::uint16_t*)&val);
+    detail::store_var<Order::LITTLE>(buf + offset, std::uint64_t(val), size);
 }
 
 /**
- * \brief Serialize a int32_t in the buffer
+ * \brief Serialize the size low bytes of a signed integer, size being known at runtime
  * \param buf Pointer to the buffer
+ * \param offset Offset in the buffer where to write the integer (in bytes)
  * \param val Value to serialize
+ * \param size Number of bytes to write, from 1 to 8
+ * \param length Auto Increment this variable by size
  */
-inline void SET_INT32(std::uint8_t* buf, const int32_t val)
+ENDN_CONSTEXPR inline void SET_INTN(
+    std::uint8_t* buf, const std::size_t offset, const int64_t val, const std::size_t size, std::size_t& length)
 {
-    SET_UINT32(buf, *(const std::uint32_t*)&val);
+    detail::store_var<Order::LITTLE>(buf + offset, std::uint64_t(val), size);
+    length += size;
 }
 
 /**
- * \brief Serialize a int48 in the buffer
+ * \brief Deserialize a fixed point value from buffer
+ * \tparam Format Fixed point format (endn::Q15, endn::Q31, endn::Fixed<int32_t, 20>, ...)
+ * \tparam T float or double
+ * \param buf Pointer to the fixed point integer
+ * \return The deserialized value, scaled by 2^-Fraction
+ */
+template<typename Format, typename T = double>
+ENDN_CONSTEXPR inline T GET_FIXED(const std::uint8_t* buf)
+{
+    return load_fixed<Format, Order::LITTLE, T>(buf);
+}
+
+/**
+ * \brief Deserialize a fixed point value from buffer
+ * \tparam Format Fixed point format (endn::Q15, endn::Q31, endn::Fixed<int32_t, 20>, ...)
+ * \tparam T float or double
  * \param buf Pointer to the buffer
- * \param val Value to serialize
- * \note For convenience the int48 is stored into a int64_t
+ * \param offset Offset in the buffer where the fixed point integer start (in bytes)
+ * \return The deserialized value, scaled by 2^-Fraction
  */
-inline void SET_INT48(std::uint8_t* buf, const int64_t val)
+template<typename Format, typename T = double>
+ENDN_CONSTEXPR inline T GET_FIXED(const std::uint8_t* buf, const std::size_t offset)
 {
-    SET_UINT48(buf, *(const std::uint64_t*)&val);
+    return load_fixed<Format, Order::LITTLE, T>(buf, offset);
 }
 
 /**
- * \brief Serialize a int64_t in the buffer
+ * \brief Serialize a value as fixed point in the buffer, saturated to the Format range (NaN give 0)
+ * \tparam Format Fixed point format (endn::Q15, endn::Q31, endn::Fixed<int32_t, 20>, ...)
  * \param buf Pointer to the buffer
  * \param val Value to serialize
  */
-inline void SET_INT64(std::uint8_t* buf, const int64_t val)
+template<typename Format, typename T>
+ENDN_CONSTEXPR inline void SET_FIXED(std::uint8_t* buf, const T val)
 {
-    SET_UINT64(buf, *(const std::uint64_t*)&val);
+    store_fixed<Format, Order::LITTLE>(buf, 0, val);
 }
 
 /**
- * \brief Serialize a float in the buffer
+ * \brief Serialize a value as fixed point in the buffer, saturated to the Format range (NaN give 0)
+ * \tparam Format Fixed point format (endn::Q15, endn::Q31, endn::Fixed<int32_t, 20>, ...)
  * \param buf Pointer to the buffer
+ * \param offset Offset in the buffer where to write the fixed point integer (in bytes)
  * \param val Value to serialize
  */
-inline void SET_FLOAT32(std::uint8_t* buf, const float val)
+template<typename Format, typename T>
+ENDN_CONSTEXPR inline void SET_FIXED(std::uint8_t* buf, const std::size_t offset, const T val)
 {
-    SET_UINT32(buf, *(const std::uint32_t*)&val);
+    store_fixed<Format, Order::LITTLE>(buf, offset, val);
 }
 
 /**
- * \brief Serialize a double in the buffer
+ * \brief Serialize a value as fixed point in the buffer, saturated to the Format range (NaN give 0)
+ * \tparam Format Fixed point format (endn::Q15, endn::Q31, endn::Fixed<int32_t, 20>, ...)
  * \param buf Pointer to the buffer
+ * \param offset Offset in the buffer where to write the fixed point integer (in bytes)
  * \param val Value to serialize
+ * \param length Auto Increment this variable by the size of the Format integer
  */
-inline void SET_FLOAT64(std::uint8_t* buf, const double val)
+template<typename Format, typename T>
+ENDN_CONSTEXPR inline void SET_FIXED(std::uint8_t* buf, const std::size_t offset, const T val, std::size_t& length)
 {
-    SET_UINT64(buf, *(const std::uint64_t*)&val);
+    store_fixed<Format, Order::LITTLE>(buf, offset, val);
+    length += sizeof(typename Format::type);
 }
 
 /**
  * \brief Serialize a std::uint8_t in the buffer
  * \param buf Pointer to the buffer
- * \param offset Offset in the buffer (in bytes)
  * \param val Value to serialize
  */
-inline void SET_UINT8(std::uint8_t* buf, const std::size_t offset, const std::uint8_t val)
+ENDN_CONSTEXPR inline void SET_UINT8(std::uint8_t* buf, const std::uint8_t val)
 {
-    SET_UINT8(&buf[offset], val);
+    store<std::uint8_t, Order::LITTLE>(buf, val);
 }
 
 /**
  * \brief Serialize a std::uint16_t in the buffer
  * \param buf Pointer to the buffer
- * \param offset Offset in the buffer (in bytes)
  * \param val Value to serialize
  */
-inline void SET_UINT16(std::uint8_t* buf, const std::size_t offset, const std::uint16_t val)
+ENDN_CONSTEXPR inline void SET_UINT16(std::uint8_t* buf, const std::uint16_t val)
+{
+    store<std::uint16_t, Order::LITTLE>(buf, val);
+}
+
+/**
+ * \brief Serialize a std::uint24_t in the buffer
+ * \param buf Pointer to the buffer
+ * \param val Value to serialize
+ * \note For convenience the std::uint24 is stored into a std::uint32_t
+ */
+ENDN_CONSTEXPR inline void SET_UINT24(std::uint8_t* buf, const std::uint32_t val)
 {
-    SET_UINT16(&buf[offset], val);
+    store<std::uint32_t, Order::LITTLE, UINT24_SIZE>(buf, val);
 }
 
 /**
  * \brief Serialize a std::uint32_t in the buffer
  * \param buf Pointer to the buffer
- * \param offset Offset in the buffer (in bytes)
  * \param val Value to serialize
  */
-inline void SET_UINT32(std::uint8_t* buf, const std::size_t offset, const std::uint32_t val)
+ENDN_CONSTEXPR inline void SET_UINT32(std::uint8_t* buf, const std::uint32_t val)
 {
-    SET_UINT32(&buf[offset], val);
+    store<std::uint32_t, Order::LITTLE>(buf, val);
 }
 
 /**
  * \brief Serialize a std::uint48_t in the buffer
  * \param buf Pointer to the buffer
- * \param offset Offset in the buffer (in bytes)
  * \param val Value to serialize
  * \note For convenience the std::uint48 is stored into a std::uint64_t
  */
-inline void SET_UINT48(std::uint8_t* buf, const std::size_t offset, const std::uint64_t val)
+ENDN_CONSTEXPR inline void SET_UINT48(std::uint8_t* buf, const std::uint64_t val)
 {
-    SET_UINT48(&buf[offset], val);
+    store<std::uint64_t, Order::LITTLE, UINT48_SIZE>(buf, val);
 }
 
 /**
  * \brief Serialize a std::uint64_t in the buffer
  * \param buf Pointer to the buffer
- * \param offset Offset in the buffer (in bytes)
  * \param val Value to serialize
  */
-inline void SET_UINT64(std::uint8_t* buf, const std::size_t offset, const std::uint64_t val)
+ENDN_CONSTEXPR inline void SET_UINT64(std::uint8_t* buf, const std::uint64_t val)
 {
-    SET_UINT64(&buf[offset], val);
+    store<std::uint64_t, Order::LITTLE>(buf, val);
+}
+
+/**
+ * \brief Serialize a uint128_t in the buffer
+ * \param buf Pointer to the buffer
+ * \param val Value to serialize
+ */
+ENDN_CONSTEXPR inline void SET_UINT128(std::uint8_t* buf, const uint128_t val)
+{
+    store_uint128<Order::LITTLE>(buf, 0, val);
 }
 
 /**
  * \brief Serialize a int8_t in the buffer
  * \param buf Pointer to the buffer
- * \param offset Offset in the buffer (in bytes)
  * \param val Value to serialize
  */
-inline void SET_INT8(std::uint8_t* buf, const std::size_t offset, const int8_t val)
+ENDN_CONSTEXPR inline void SET_INT8(std::uint8_t* buf, const int8_t val)
 {
-    SET_INT8(&buf[offset], val);
+    store<int8_t, Order::LITTLE>(buf, val);
 }
 
 /**
  * \brief Serialize a int16_t in the buffer
  * \param buf Pointer to the buffer
- * \param offset Offset in the buffer (in bytes)
  * \param val Value to serialize
  */
-inline void SET_INT16(std::uint8_t* buf, const std::size_t offset, const int16_t val)
+ENDN_CONSTEXPR inline void SET_INT16(std::uint8_t* buf, const int16_t val)
+{
+    store<int16_t, Order::LITTLE>(buf, val);
+}
+
+/**
+ * \brief Serialize a int24 in the buffer
+ * \param buf Pointer to the buffer
+ * \param val Value to serialize
+ * \note For convenience the int24 is stored into a int32_t
+ */
+ENDN_CONSTEXPR inline void SET_INT24(std::uint8_t* buf, const int32_t val)
 {
-    SET_INT16(&buf[offset], val);
+    store<int32_t, Order::LITTLE, INT24_SIZE>(buf, val);
 }
 
 /**
  * \brief Serialize a int32_t in the buffer
  * \param buf Pointer to the buffer
- * \param offset Offset in the buffer (in bytes)
  * \param val Value to serialize
  */
-inline void SET_INT32(std::uint8_t* buf, const std::size_t offset, const int32_t val)
+ENDN_CONSTEXPR inline void SET_INT32(std::uint8_t* buf, const int32_t val)
 {
-    SET_INT32(&buf[offset], val);
+    store<int32_t, Order::LITTLE>(buf, val);
 }
 
 /**
- * \brief Serialize a int48_t in the buffer
+ * \brief Serialize a int48 in the buffer
  * \param buf Pointer to the buffer
- * \param offset Offset in the buffer (in bytes)
  * \param val Value to serialize
  * \note For convenience the int48 is stored into a int64_t
  */
-inline void SET_INT48(std::uint8_t* buf, const std::size_t offset, const int64_t val)
+ENDN_CONSTEXPR inline void SET_INT48(std::uint8_t* buf, const int64_t val)
 {
-    SET_INT48(&buf[offset], val);
+    store<int64_t, Order::LITTLE, INT48_SIZE>(buf, val);
 }
 
 /**
  * \brief Serialize a int64_t in the buffer
  * \param buf Pointer to the buffer
- * \param offset Offset in the buffer (in bytes)
  * \param val Value to serialize
  */
-inline void SET_INT64(std::uint8_t* buf, const std::size_t offset, const int64_t val)
+ENDN_CONSTEXPR inline void SET_INT64(std::uint8_t* buf, const int64_t val)
 {
-    SET_INT64(&buf[offset], val);
+    store<int64_t, Order::LITTLE>(buf, val);
 }
 
 /**
  * \brief Serialize a float in the buffer
  * \param buf Pointer to the buffer
- * \param offset Offset in the buffer (in bytes)
  * \param val Value to serialize
  */
-inline void SET_FLOAT32(std::uint8_t* buf, const std::size_t offset, const float val)
+ENDN_CONSTEXPR inline void SET_FLOAT32(std::uint8_t* buf, const float val)
 {
-    SET_FLOAT32(&buf[offset], val);
+    store<float, Order::LITTLE>(buf, val);
 }
 
 /**
- * \brief Serialize a double in the buffer
+ * \brief Serialize a float as binary16 in the buffer
  * \param buf Pointer to the buffer
- * \param offset Offset in the buffer (in bytes)
  * \param val Value to serialize
  */
-inline void SET_FLOAT64(std::uint8_t* buf, const std::size_t offset, const double val)
+ENDN_CONSTEXPR inline void SET_FLOAT16(std::uint8_t* buf, const float val)
 {
-    SET_FLOAT64(&buf[offset], val);
+    store_float16<Order::LITTLE>(buf, 0, val);
 }
 
 /**
- * \brief Serialize a std::uint8_t in the buffer
+ * \brief Serialize a float as bfloat16 in the buffer
  * \param buf Pointer to the buffer
- * \param offset Offset in the buffer (in bytes)
- * \param length Auto Increment this variable by the size of std::uint8_t
  * \param val Value to serialize
  */
-inline void SET_UINT8(std::uint8_t* buf, const std::size_t offset, const std::uint8_t val, std::size_t& length)
+ENDN_CONSTEXPR inline void SET_BFLOAT16(std::uint8_t* buf, const float val)
 {
-    SET_UINT8(buf, offset, val);
-    length += UINT8_SIZE;
+    store_bfloat16<Order::LITTLE>(buf, 0, val);
 }
 
 /**
- * \brief Serialize a std::uint16_t in the buffer
+ * \brief Serialize a double in the buffer
  * \param buf Pointer to the buffer
- * \param offset Offset in the buffer (in bytes)
- * \param length Auto Increment this variable by the size of std::uint16_t
  * \param val Value to serialize
  */
-inline void SET_UINT16(std::uint8_t* buf, const std::size_t offset, const std::uint16_t val, std::size_t& length)
+ENDN_CONSTEXPR inline void SET_FLOAT64(std::uint8_t* buf, const double val)
 {
-    SET_UINT16(buf, offset, val);
-    length += UINT16_SIZE;
+    store<double, Order::LITTLE>(buf, val);
 }
 
 /**
- * \brief Serialize a std::uint32_t in the buffer
+ * \brief Serialize a std::uint8_t in the buffer
  * \param buf Pointer to the buffer
  * \param offset Offset in the buffer (in bytes)
- * \param length Auto Increment this variable by the size of std::uint32_t
  * \param val Value to serialize
  */
-inline void SET_UINT32(std::uint8_t* buf, const std::size_t offset, const std::uint32_t val, std::size_t& length)
+ENDN_CONSTEXPR inline void SET_UINT8(std::uint8_t* buf, const std::size_t offset, const std::uint8_t val)
 {
-    SET_UINT32(buf, offset, val);
-    length += UINT32_SIZE;
+    store<std::uint8_t, Order::LITTLE>(buf, offset, val);
 }
 
 /**
- * \brief Serialize a std::uint48_t in the buffer
+ * \brief Serialize a std::uint16_t in the buffer
  * \param buf Pointer to the buffer
  * \param offset Offset in the buffer (in bytes)
- * \param length Auto Increment this variable by the size of std::uint48_t
- * \note For convenience the std::uint48 is stored into a std::uint64_t
  * \param val Value to serialize
  */
-inline void SET_UINT48(std::uint8_t* buf, const std::size_t offset, const std::uint64_t val, std::size_t& length)
+ENDN_CONSTEXPR inline void SET_UINT16(std::uint8_t* buf, const std::size_t offset, const std::uint16_t val)
 {
-    SET_UINT48(buf, offset, val);
-    length += UINT48_SIZE;
+    store<std::uint16_t, Order::LITTLE>(buf, offset, val);
 }
 
 /**
- * \brief Serialize a std::uint64_t in the buffer
+ * \brief Serialize a std::uint24_t in the buffer
  * \param buf Pointer to the buffer
  * \param offset Offset in the buffer (in bytes)
- * \param length Auto Increment this variable by the size of std::uint64_t
  * \param val Value to serialize
+ * \note For convenience the std::uint24 is stored into a std::uint32_t
  */
-inline void SET_UINT64(std::uint8_t* buf, const std::size_t offset, const std::uint64_t val, std::size_t& length)
+ENDN_CONSTEXPR inline void SET_UINT24(std::uint8_t* buf, const std::size_t offset, const std::uint32_t val)
 {
-    SET_UINT64(buf, offset, val);
-    length += UINT64_SIZE;
+    store<std::uint32_t, Order::LITTLE, UINT24_SIZE>(buf, offset, val);
 }
 
 /**
- * \brief Serialize a int8_t in the buffer
+ * \brief Serialize a std::uint32_t in the buffer
  * \param buf Pointer to the buffer
  * \param offset Offset in the buffer (in bytes)
- * \param length Auto Increment this variable by the size of int8_t
  * \param val Value to serialize
  */
-inline void SET_INT8(std::uint8_t* buf, const std::size_t offset, const int8_t val, std::size_t& length)
+ENDN_CONSTEXPR inline void SET_UINT32(std::uint8_t* buf, const std::size_t offset, const std::uint32_t val)
 {
-    SET_INT8(buf, offset, val);
-    length += INT8_SIZE;
+    store<std::uint32_t, Order::LITTLE>(buf, offset, val);
 }
 
 /**
- * \brief Serialize a int16_t in the buffer
+ * \brief Serialize a std::uint48_t in the buffer
  * \param buf Pointer to the buffer
  * \param offset Offset in the buffer (in bytes)
- * \param length Auto Increment this variable by the size of int16_t
  * \param val Value to serialize
+ * \note For convenience the std::uint48 is stored into a std::uint64_t
  */
-inline void SET_INT16(std::uint8_t* buf, const std::size_t offset, const int16_t val, std::size_t& length)
+ENDN_CONSTEXPR inline void SET_UINT48(std::uint8_t* buf, const std::size_t offset, const std::uint64_t val)
 {
-    SET_INT16(buf, offset, val);
-    length += INT16_SIZE;
+    store<std::uint64_t, Order::LITTLE, UINT48_SIZE>(buf, offset, val);
 }
 
 /**
- * \brief Serialize a int32_t in the buffer
+ * \brief Serialize a std::uint64_t in the buffer
  * \param buf Pointer to the buffer
  * \param offset Offset in the buffer (in bytes)
- * \param length Auto Increment this variable by the size of int32_t
  * \param val Value to serialize
  */
-inline void SET_INT32(std::uint8_t* buf, const std::size_t offset, const int32_t val, std::size_t& length)
+ENDN_CONSTEXPR inline void SET_UINT64(std::uint8_t* buf, const std::size_t offset, const std::uint64_t val)
 {
-    SET_INT32(buf, offset, val);
-    length += INT32_SIZE;
+    store<std::uint64_t, Order::LITTLE>(buf, offset, val);
 }
 
 /**
- * \brief Serialize a int48_t in the buffer
+ * \brief Serialize a uint128_t in the buffer
  * \param buf Pointer to the buffer
  * \param offset Offset in the buffer (in bytes)
- * \param length Auto Increment this variable by the size of int48_t
- * \note For convenience the int48 is stored into a int64_t
  * \param val Value to serialize
  */
-inline void SET_INT48(std::uint8_t* buf, const std::size_t offset, const int64_t val, std::size_t& length)
+ENDN_CONSTEXPR inline void SET_UINT128(std::uint8_t* buf, const std::size_t offset, const uint128_t val)
 {
-    SET_INT48(buf, offset, val);
-    length += INT48_SIZE;
+    store_uint128<Order::LITTLE>(buf, offset, val);
 }
 
 /**
- * \brief Serialize a int64_t in the buffer
+ * \brief Serialize a int8_t in the buffer
+ * \param buf Pointer to the buffer
+ * \param offset Offset in the buffer (in bytes)
+ * \param val Value to serialize
+ */
+ENDN_CONSTEXPR inline void SET_INT8(std::uint8_t* buf, const std::size_t offset, const int8_t val)
+{
+    store<int8_t, Order::LITTLE>(buf, offset, val);
+}
+
+/**
+ * \brief Serialize a int16_t in the buffer
+ * \param buf Pointer to the buffer
+ * \param offset Offset in the buffer (in bytes)
+ * \param val Value to serialize
+ */
+ENDN_CONSTEXPR inline void SET_INT16(std::uint8_t* buf, const std::size_t offset, const int16_t val)
+{
+    store<int16_t, Order::LITTLE>(buf, offset, val);
+}
+
+/**
+ * \brief Serialize a int24_t in the buffer
+ * \param buf Pointer to the buffer
+ * \param offset Offset in the buffer (in bytes)
+ * \param val Value to serialize
+ * \note For convenience the int24 is stored into a int32_t
+ */
+ENDN_CONSTEXPR inline void SET_INT24(std::uint8_t* buf, const std::size_t offset, const int32_t val)
+{
+    store<int32_t, Order::LITTLE, INT24_SIZE>(buf, offset, val);
+}
+
+/**
+ * \brief Serialize a int32_t in the buffer
+ * \param buf Pointer to the buffer
+ * \param offset Offset in the buffer (in bytes)
+ * \param val Value to serialize
+ */
+ENDN_CONSTEXPR inline void SET_INT32(std::uint8_t* buf, const std::size_t offset, const int32_t val)
+{
+    store<int32_t, Order::LITTLE>(buf, offset, val);
+}
+
+/**
+ * \brief Serialize a int48_t in the buffer
+ * \param buf Pointer to the buffer
+ * \param offset Offset in the buffer (in bytes)
+ * \param val Value to serialize
+ * \note For convenience the int48 is stored into a int64_t
+ */
+ENDN_CONSTEXPR inline void SET_INT48(std::uint8_t* buf, const std::size_t offset, const int64_t val)
+{
+    store<int64_t, Order::LITTLE, INT48_SIZE>(buf, offset, val);
+}
+
+/**
+ * \brief Serialize a int64_t in the buffer
+ * \param buf Pointer to the buffer
+ * \param offset Offset in the buffer (in bytes)
+ * \param val Value to serialize
+ */
+ENDN_CONSTEXPR inline void SET_INT64(std::uint8_t* buf, const std::size_t offset, const int64_t val)
+{
+    store<int64_t, Order::LITTLE>(buf, offset, val);
+}
+
+/**
+ * \brief Serialize a float in the buffer
+ * \param buf Pointer to the buffer
+ * \param offset Offset in the buffer (in bytes)
+ * \param val Value to serialize
+ */
+ENDN_CONSTEXPR inline void SET_FLOAT32(std::uint8_t* buf, const std::size_t offset, const float val)
+{
+    store<float, Order::LITTLE>(buf, offset, val);
+}
+
+/**
+ * \brief Serialize a float as binary16 in the buffer
+ * \param buf Pointer to the buffer
+ * \param offset Offset in the buffer (in bytes)
+ * \param val Value to serialize
+ */
+ENDN_CONSTEXPR inline void SET_FLOAT16(std::uint8_t* buf, const std::size_t offset, const float val)
+{
+    store_float16<Order::LITTLE>(buf, offset, val);
+}
+
+/**
+ * \brief Serialize a float as bfloat16 in the buffer
+ * \param buf Pointer to the buffer
+ * \param offset Offset in the buffer (in bytes)
+ * \param val Value to serialize
+ */
+ENDN_CONSTEXPR inline void SET_BFLOAT16(std::uint8_t* buf, const std::size_t offset, const float val)
+{
+    store_bfloat16<Order::LITTLE>(buf, offset, val);
+}
+
+/**
+ * \brief Serialize a double in the buffer
+ * \param buf Pointer to the buffer
+ * \param offset Offset in the buffer (in bytes)
+ * \param val Value to serialize
+ */
+ENDN_CONSTEXPR inline void SET_FLOAT64(std::uint8_t* buf, const std::size_t offset, const double val)
+{
+    store<double, Order::LITTLE>(buf, offset, val);
+}
+
+/**
+ * \brief Serialize a std::uint8_t in the buffer
+ * \param buf Pointer to the buffer
+ * \param offset Offset in the buffer (in bytes)
+ * \param length Auto Increment this variable by the size of std::uint8_t
+ * \param val Value to serialize
+ */
+ENDN_CONSTEXPR inline void SET_UINT8(std::uint8_t* buf, const std::size_t offset, const std::uint8_t val, std::size_t& length)
+{
+    store<std::uint8_t, Order::LITTLE>(buf, offset, val);
+    length += UINT8_SIZE;
+}
+
+/**
+ * \brief Serialize a std::uint16_t in the buffer
+ * \param buf Pointer to the buffer
+ * \param offset Offset in the buffer (in bytes)
+ * \param length Auto Increment this variable by the size of std::uint16_t
+ * \param val Value to serialize
+ */
+ENDN_CONSTEXPR inline void SET_UINT16(std::uint8_t* buf, const std::size_t offset, const std::uint16_t val, std::size_t& length)
+{
+    store<std::uint16_t, Order::LITTLE>(buf, offset, val);
+    length += UINT16_SIZE;
+}
+
+/**
+ * \brief Serialize a std::uint24_t in the buffer
+ * \param buf Pointer to the buffer
+ * \param offset Offset in the buffer (in bytes)
+ * \param length Auto Increment this variable by the size of std::uint24_t
+ * \note For convenience the std::uint24 is stored into a std::uint32_t
+ * \param val Value to serialize
+ */
+ENDN_CONSTEXPR inline void SET_UINT24(std::uint8_t* buf, const std::size_t offset, const std::uint32_t val, std::size_t& length)
+{
+    store<std::uint32_t, Order::LITTLE, UINT24_SIZE>(buf, offset, val);
+    length += UINT24_SIZE;
+}
+
+/**
+ * \brief Serialize a std::uint32_t in the buffer
+ * \param buf Pointer to the buffer
+ * \param offset Offset in the buffer (in bytes)
+ * \param length Auto Increment this variable by the size of std::uint32_t
+ * \param val Value to serialize
+ */
+ENDN_CONSTEXPR inline void SET_UINT32(std::uint8_t* buf, const std::size_t offset, const std::uint32_t val, std::size_t& length)
+{
+    store<std::uint32_t, Order::LITTLE>(buf, offset, val);
+    length += UINT32_SIZE;
+}
+
+/**
+ * \brief Serialize a std::uint48_t in the buffer
+ * \param buf Pointer to the buffer
+ * \param offset Offset in the buffer (in bytes)
+ * \param length Auto Increment this variable by the size of std::uint48_t
+ * \note For convenience the std::uint48 is stored into a std::uint64_t
+ * \param val Value to serialize
+ */
+ENDN_CONSTEXPR inline void SET_UINT48(std::uint8_t* buf, const std::size_t offset, const std::uint64_t val, std::size_t& length)
+{
+    store<std::uint64_t, Order::LITTLE, UINT48_SIZE>(buf, offset, val);
+    length += UINT48_SIZE;
+}
+
+/**
+ * \brief Serialize a std::uint64_t in the buffer
+ * \param buf Pointer to the buffer
+ * \param offset Offset in the buffer (in bytes)
+ * \param length Auto Increment this variable by the size of std::uint64_t
+ * \param val Value to serialize
+ */
+ENDN_CONSTEXPR inline void SET_UINT64(std::uint8_t* buf, const std::size_t offset, const std::uint64_t val, std::size_t& length)
+{
+    store<std::uint64_t, Order::LITTLE>(buf, offset, val);
+    length += UINT64_SIZE;
+}
+
+/**
+ * \brief Serialize a uint128_t in the buffer
+ * \param buf Pointer to the buffer
+ * \param offset Offset in the buffer (in bytes)
+ * \param length Auto Increment this variable by the size of uint128_t
+ * \param val Value to serialize
+ */
+ENDN_CONSTEXPR inline void SET_UINT128(std::uint8_t* buf, const std::size_t offset, const uint128_t val, std::size_t& length)
+{
+    store_uint128<Order::LITTLE>(buf, offset, val);
+    length += UINT128_SIZE;
+}
+
+/**
+ * \brief Serialize a int8_t in the buffer
+ * \param buf Pointer to the buffer
+ * \param offset Offset in the buffer (in bytes)
+ * \param length Auto Increment this variable by the size of int8_t
+ * \param val Value to serialize
+ */
+ENDN_CONSTEXPR inline void SET_INT8(std::uint8_t* buf, const std::size_t offset, const int8_t val, std::size_t& length)
+{
+    store<int8_t, Order::LITTLE>(buf, offset, val);
+    length += INT8_SIZE;
+}
+
+/**
+ * \brief Serialize a int16_t in the buffer
+ * \param buf Pointer to the buffer
+ * \param offset Offset in the buffer (in bytes)
+ * \param length Auto Increment this variable by the size of int16_t
+ * \param val Value to serialize
+ */
+ENDN_CONSTEXPR inline void SET_INT16(std::uint8_t* buf, const std::size_t offset, const int16_t val, std::size_t& length)
+{
+    store<int16_t, Order::LITTLE>(buf, offset, val);
+    length += INT16_SIZE;
+}
+
+/**
+ * \brief Serialize a int24_t in the buffer
+ * \param buf Pointer to the buffer
+ * \param offset Offset in the buffer (in bytes)
+ * \param length Auto Increment this variable by the size of int24_t
+ * \note For convenience the int24 is stored into a int32_t
+ * \param val Value to serialize
+ */
+ENDN_CONSTEXPR inline void SET_INT24(std::uint8_t* buf, const std::size_t offset, const int32_t val, std::size_t& length)
+{
+    store<int32_t, Order::LITTLE, INT24_SIZE>(buf, offset, val);
+    length += INT24_SIZE;
+}
+
+/**
+ * \brief Serialize a int32_t in the buffer
+ * \param buf Pointer to the buffer
+ * \param offset Offset in the buffer (in bytes)
+ * \param length Auto Increment this variable by the size of int32_t
+ * \param val Value to serialize
+ */
+ENDN_CONSTEXPR inline void SET_INT32(std::uint8_t* buf, const std::size_t offset, const int32_t val, std::size_t& length)
+{
+    store<int32_t, Order::LITTLE>(buf, offset, val);
+    length += INT32_SIZE;
+}
+
+/**
+ * \brief Serialize a int48_t in the buffer
+ * \param buf Pointer to the buffer
+ * \param offset Offset in the buffer (in bytes)
+ * \param length Auto Increment this variable by the size of int48_t
+ * \note For convenience the int48 is stored into a int64_t
+ * \param val Value to serialize
+ */
+ENDN_CONSTEXPR inline void SET_INT48(std::uint8_t* buf, const std::size_t offset, const int64_t val, std::size_t& length)
+{
+    store<int64_t, Order::LITTLE, INT48_SIZE>(buf, offset, val);
+    length += INT48_SIZE;
+}
+
+/**
+ * \brief Serialize a int64_t in the buffer
  * \param buf Pointer to the buffer
  * \param offset Offset in the buffer (in bytes)
  * \param length Auto Increment this variable by the size of int64_t
  * \param val Value to serialize
  */
-inline void SET_INT64(std::uint8_t* buf, const std::size_t offset, const int64_t val, std::size_t& length)
+ENDN_CONSTEXPR inline void SET_INT64(std::uint8_t* buf, const std::size_t offset, const int64_t val, std::size_t& length)
 {
-    SET_INT64(buf, offset, val);
+    store<int64_t, Order::LITTLE>(buf, offset, val);
     length += INT64_SIZE;
 }
 
 /**
- * \brief Serialize a float in the buffer
+ * \brief Serialize a float in the buffer
+ * \param buf Pointer to the buffer
+ * \param offset Offset in the buffer (in bytes)
+ * \param length Auto Increment this variable by the size of float
+ * \param val Value to serialize
+ */
+ENDN_CONSTEXPR inline void SET_FLOAT32(std::uint8_t* buf, const std::size_t offset, const float val, std::size_t& length)
+{
+    store<float, Order::LITTLE>(buf, offset, val);
+    length += FLOAT32_SIZE;
+}
+
+/**
+ * \brief Serialize a float as binary16 in the buffer
+ * \param buf Pointer to the buffer
+ * \param offset Offset in the buffer (in bytes)
+ * \param length Auto Increment this variable by the size of binary16 float
+ * \param val Value to serialize
+ */
+ENDN_CONSTEXPR inline void SET_FLOAT16(std::uint8_t* buf, const std::size_t offset, const float val, std::size_t& length)
+{
+    store_float16<Order::LITTLE>(buf, offset, val);
+    length += FLOAT16_SIZE;
+}
+
+/**
+ * \brief Serialize a float as bfloat16 in the buffer
+ * \param buf Pointer to the buffer
+ * \param offset Offset in the buffer (in bytes)
+ * \param length Auto Increment this variable by the size of bfloat16
+ * \param val Value to serialize
+ */
+ENDN_CONSTEXPR inline void SET_BFLOAT16(std::uint8_t* buf, const std::size_t offset, const float val, std::size_t& length)
+{
+    store_bfloat16<Order::LITTLE>(buf, offset, val);
+    length += BFLOAT16_SIZE;
+}
+
+/**
+ * \brief Serialize a double in the buffer
+ * \param buf Pointer to the buffer
+ * \param offset Offset in the buffer (in bytes)
+ * \param length Auto Increment this variable by the size of double
+ * \param val Value to serialize
+ */
+ENDN_CONSTEXPR inline void SET_FLOAT64(std::uint8_t* buf, const std::size_t offset, const double val, std::size_t& length)
+{
+    store<double, Order::LITTLE>(buf, offset, val);
+    length += FLOAT64_SIZE;
+}
+
+/**
+ * \brief memcpy from a little endian 16 bits to a local buffer
+ * \param dest ptr to local std::uint16_t buffer, that contains std::uint16_t
+ * \param src ptr to little endian buffer of std::uint16_t that need to be deserialized in dest
+ * \param count Number of std::uint16_t in src
+ */
+inline void MEMCPY_UINT16(std::uint16_t* dest, const std::uint8_t* src, const std::size_t count)
+{
+#ifdef ENDN_IS_BIG_ENDIAN
+    detail::swap_array<std::uint16_t>(dest, src, count);
+#else
+    detail::copy_array(dest, src, count * UINT16_SIZE);
+#endif
+}
+
+/**
+ * \brief memcpy from a little endian packed 24 bits array to a local buffer
+ * \param dest ptr to local std::uint32_t buffer, that contains std::uint24_t
+ * \param src ptr to little endian buffer of packed std::uint24_t (3 bytes each) that need to be deserialized in dest
+ * \param count Number of std::uint24_t in src
+ * \note src and dest must not overlap
+ */
+inline void MEMCPY_UINT24(std::uint32_t* dest, const std::uint8_t* src, const std::size_t count)
+{
+    detail::unpack24<Order::LITTLE, false>(dest, src, count);
+}
+
+/**
+ * \brief memcpy from a little endian 32 bits to a local buffer
+ * \param dest ptr to local std::uint32_t buffer, that contains std::uint32_t
+ * \param src ptr to little endian buffer of std::uint32_t that need to be deserialized in dest
+ * \param count Number of std::uint32_t in src
+ */
+inline void MEMCPY_UINT32(std::uint32_t* dest, const std::uint8_t* src, const std::size_t count)
+{
+#ifdef ENDN_IS_BIG_ENDIAN
+    detail::swap_array<std::uint32_t>(dest, src, count);
+#else
+    detail::copy_array(dest, src, count * UINT32_SIZE);
+#endif
+}
+
+/**
+ * \brief memcpy from a little endian packed 48 bits array to a local buffer
+ * \param dest ptr to local std::uint64_t buffer, that contains std::uint48_t
+ * \param src ptr to little endian buffer of packed std::uint48_t (6 bytes each) that need to be deserialized in dest
+ * \param count Number of std::uint48_t in src
+ * \note src and dest must not overlap
+ */
+inline void MEMCPY_UINT48(std::uint64_t* dest, const std::uint8_t* src, const std::size_t count)
+{
+    detail::unpack48<Order::LITTLE, false>(dest, src, count);
+}
+
+/**
+ * \brief memcpy from a little endian 64 bits to a local buffer
+ * \param dest ptr to local std::uint64_t buffer, that contains std::uint64_t
+ * \param src ptr to little endian buffer of std::uint64_t that need to be deserialized in dest
+ * \param count Number of std::uint64_t in src
+ */
+inline void MEMCPY_UINT64(std::uint64_t* dest, const std::uint8_t* src, const std::size_t count)
+{
+#ifdef ENDN_IS_BIG_ENDIAN
+    detail::swap_array<std::uint64_t>(dest, src, count);
+#else
+    detail::copy_array(dest, src, count * UINT64_SIZE);
+#endif
+}
+
+/**
+ * \brief memcpy from a little endian 128 bits to a local buffer
+ * \param dest ptr to local uint128_t buffer, that contains uint128_t
+ * \param src ptr to little endian buffer of uint128_t that need to be deserialized in dest
+ * \param count Number of uint128_t in src
+ */
+inline void MEMCPY_UINT128(uint128_t* dest, const std::uint8_t* src, const std::size_t count)
+{
+#ifdef ENDN_IS_BIG_ENDIAN
+    detail::swap_array<uint128_t>(dest, src, count);
+#else
+    detail::copy_array(dest, src, count * UINT128_SIZE);
+#endif
+}
+
+/**
+ * \brief memcpy from a little endian 16 bits signed array to a local buffer
+ * \param dest ptr to local int16_t buffer, that contains int16_t
+ * \param src ptr to little endian buffer of int16_t that need to be deserialized in dest
+ * \param count Number of int16_t in src
+ */
+inline void MEMCPY_INT16(int16_t* dest, const std::uint8_t* src, const std::size_t count)
+{
+    MEMCPY_UINT16(reinterpret_cast<std::uint16_t*>(dest), src, count);
+}
+
+/**
+ * \brief memcpy from a little endian packed 24 bits array to a local buffer, with sign extension
+ * \param dest ptr to local int32_t buffer, that contains int24_t
+ * \param src ptr to little endian buffer of packed int24_t (3 bytes each) that need to be deserialized in dest
+ * \param count Number of int24_t in src
+ * \note src and dest must not overlap
+ */
+inline void MEMCPY_INT24(int32_t* dest, const std::uint8_t* src, const std::size_t count)
+{
+    detail::unpack24<Order::LITTLE, true>(reinterpret_cast<std::uint32_t*>(dest), src, count);
+}
+
+/**
+ * \brief memcpy from a little endian 32 bits signed array to a local buffer
+ * \param dest ptr to local int32_t buffer, that contains int32_t
+ * \param src ptr to little endian buffer of int32_t that need to be deserialized in dest
+ * \param count Number of int32_t in src
+ */
+inline void MEMCPY_INT32(int32_t* dest, const std::uint8_t* src, const std::size_t count)
+{
+    MEMCPY_UINT32(reinterpret_cast<std::uint32_t*>(dest), src, count);
+}
+
+/**
+ * \brief memcpy from a little endian packed 48 bits array to a local buffer, with sign extension
+ * \param dest ptr to local int64_t buffer, that contains int48_t
+ * \param src ptr to little endian buffer of packed int48_t (6 bytes each) that need to be deserialized in dest
+ * \param count Number of int48_t in src
+ * \note src and dest must not overlap
+ */
+inline void MEMCPY_INT48(int64_t* dest, const std::uint8_t* src, const std::size_t count)
+{
+    detail::unpack48<Order::LITTLE, true>(reinterpret_cast<std::uint64_t*>(dest), src, count);
+}
+
+/**
+ * \brief memcpy from a little endian 64 bits signed array to a local buffer
+ * \param dest ptr to local int64_t buffer, that contains int64_t
+ * \param src ptr to little endian buffer of int64_t that need to be deserialized in dest
+ * \param count Number of int64_t in src
+ */
+inline void MEMCPY_INT64(int64_t* dest, const std::uint8_t* src, const std::size_t count)
+{
+    MEMCPY_UINT64(reinterpret_cast<std::uint64_t*>(dest), src, count);
+}
+
+/**
+ * \brief Convert in place a little endian buffer of std::uint16_t to host byte order
+ * \param buf ptr to little endian buffer of std::uint16_t, that will contain host std::uint16_t
+ * \param count Number of std::uint16_t in buf
+ * \note This is a no-op when the host is little endian
+ */
+inline void SWAP_INPLACE_UINT16(std::uint16_t* buf, const std::size_t count)
+{
+#ifdef ENDN_IS_BIG_ENDIAN
+    detail::swap_array<std::uint16_t>(buf, buf, count);
+#else
+    (void)buf;
+    (void)count;
+#endif
+}
+
+/**
+ * \brief Convert in place a little endian buffer of std::uint32_t to host byte order
+ * \param buf ptr to little endian buffer of std::uint32_t, that will contain host std::uint32_t
+ * \param count Number of std::uint32_t in buf
+ * \note This is a no-op when the host is little endian
+ */
+inline void SWAP_INPLACE_UINT32(std::uint32_t* buf, const std::size_t count)
+{
+#ifdef ENDN_IS_BIG_ENDIAN
+    detail::swap_array<std::uint32_t>(buf, buf, count);
+#else
+    (void)buf;
+    (void)count;
+#endif
+}
+
+/**
+ * \brief Convert in place a little endian buffer of std::uint64_t to host byte order
+ * \param buf ptr to little endian buffer of std::uint64_t, that will contain host std::uint64_t
+ * \param count Number of std::uint64_t in buf
+ * \note This is a no-op when the host is little endian
+ */
+inline void SWAP_INPLACE_UINT64(std::uint64_t* buf, const std::size_t count)
+{
+#ifdef ENDN_IS_BIG_ENDIAN
+    detail::swap_array<std::uint64_t>(buf, buf, count);
+#else
+    (void)buf;
+    (void)count;
+#endif
+}
+
+/**
+ * \brief Serialize an array of std::uint16_t in the buffer
+ * \param buf Pointer to the buffer
+ * \param src ptr to host buffer of std::uint16_t to serialize
+ * \param count Number of std::uint16_t in src
+ * \return Number of bytes written in buf
+ */
+inline std::size_t SET_ARRAY_UINT16(std::uint8_t* buf, const std::uint16_t* src, const std::size_t count)
+{
+#ifdef ENDN_IS_BIG_ENDIAN
+    detail::swap_array<std::uint16_t>(buf, src, count);
+#else
+    detail::copy_array(buf, src, count * UINT16_SIZE);
+#endif
+    return count * UINT16_SIZE;
+}
+
+/**
+ * \brief Serialize an array of std::uint16_t in the buffer
+ * \param buf Pointer to the buffer
+ * \param offset Offset in the buffer (in bytes)
+ * \param src ptr to host buffer of std::uint16_t to serialize
+ * \param count Number of std::uint16_t in src
+ * \return Number of bytes written in buf
+ */
+inline std::size_t SET_ARRAY_UINT16(std::uint8_t* buf, const std::size_t offset, const std::uint16_t* src, const std::size_t count)
+{
+    return SET_ARRAY_UINT16(&buf[offset], src, count);
+}
+
+/**
+ * \brief Serialize an array of std::uint16_t in the buffer
+ * \param buf Pointer to the buffer
+ * \param offset Offset in the buffer (in bytes)
+ * \param src ptr to host buffer of std::uint16_t to serialize
+ * \param count Number of std::uint16_t in src
+ * \param length Auto Increment this variable by the number of bytes written
+ * \return Number of bytes written in buf
+ */
+inline std::size_t SET_ARRAY_UINT16(
+    std::uint8_t* buf, const std::size_t offset, const std::uint16_t* src, const std::size_t count, std::size_t& length)
+{
+    const std::size_t written = SET_ARRAY_UINT16(buf, offset, src, count);
+    length += written;
+    return written;
+}
+
+/**
+ * \brief Serialize an array of std::uint24_t in the buffer
+ * \param buf Pointer to the buffer
+ * \param src ptr to host buffer of std::uint32_t to serialize
+ * \param count Number of std::uint24_t in src
+ * \note For convenience each std::uint24 is read from a std::uint32_t
+ * \return Number of bytes written in buf
+ */
+inline std::size_t SET_ARRAY_UINT24(std::uint8_t* buf, const std::uint32_t* src, const std::size_t count)
+{
+    detail::pack24<Order::LITTLE>(buf, src, count);
+    return count * UINT24_SIZE;
+}
+
+/**
+ * \brief Serialize an array of std::uint24_t in the buffer
+ * \param buf Pointer to the buffer
+ * \param offset Offset in the buffer (in bytes)
+ * \param src ptr to host buffer of std::uint32_t to serialize
+ * \param count Number of std::uint24_t in src
+ * \return Number of bytes written in buf
+ */
+inline std::size_t SET_ARRAY_UINT24(std::uint8_t* buf, const std::size_t offset, const std::uint32_t* src, const std::size_t count)
+{
+    return SET_ARRAY_UINT24(&buf[offset], src, count);
+}
+
+/**
+ * \brief Serialize an array of std::uint24_t in the buffer
+ * \param buf Pointer to the buffer
+ * \param offset Offset in the buffer (in bytes)
+ * \param src ptr to host buffer of std::uint32_t to serialize
+ * \param count Number of std::uint24_t in src
+ * \param length Auto Increment this variable by the number of bytes written
+ * \return Number of bytes written in buf
+ */
+inline std::size_t SET_ARRAY_UINT24(
+    std::uint8_t* buf, const std::size_t offset, const std::uint32_t* src, const std::size_t count, std::size_t& length)
+{
+    const std::size_t written = SET_ARRAY_UINT24(buf, offset, src, count);
+    length += written;
+    return written;
+}
+
+/**
+ * \brief Serialize an array of std::uint32_t in the buffer
+ * \param buf Pointer to the buffer
+ * \param src ptr to host buffer of std::uint32_t to serialize
+ * \param count Number of std::uint32_t in src
+ * \return Number of bytes written in buf
+ */
+inline std::size_t SET_ARRAY_UINT32(std::uint8_t* buf, const std::uint32_t* src, const std::size_t count)
+{
+#ifdef ENDN_IS_BIG_ENDIAN
+    detail::swap_array<std::uint32_t>(buf, src, count);
+#else
+    detail::copy_array(buf, src, count * UINT32_SIZE);
+#endif
+    return count * UINT32_SIZE;
+}
+
+/**
+ * \brief Serialize an array of std::uint32_t in the buffer
+ * \param buf Pointer to the buffer
+ * \param offset Offset in the buffer (in bytes)
+ * \param src ptr to host buffer of std::uint32_t to serialize
+ * \param count Number of std::uint32_t in src
+ * \return Number of bytes written in buf
+ */
+inline std::size_t SET_ARRAY_UINT32(std::uint8_t* buf, const std::size_t offset, const std::uint32_t* src, const std::size_t count)
+{
+    return SET_ARRAY_UINT32(&buf[offset], src, count);
+}
+
+/**
+ * \brief Serialize an array of std::uint32_t in the buffer
+ * \param buf Pointer to the buffer
+ * \param offset Offset in the buffer (in bytes)
+ * \param src ptr to host buffer of std::uint32_t to serialize
+ * \param count Number of std::uint32_t in src
+ * \param length Auto Increment this variable by the number of bytes written
+ * \return Number of bytes written in buf
+ */
+inline std::size_t SET_ARRAY_UINT32(
+    std::uint8_t* buf, const std::size_t offset, const std::uint32_t* src, const std::size_t count, std::size_t& length)
+{
+    const std::size_t written = SET_ARRAY_UINT32(buf, offset, src, count);
+    length += written;
+    return written;
+}
+
+/**
+ * \brief Serialize an array of std::uint48_t in the buffer
+ * \param buf Pointer to the buffer
+ * \param src ptr to host buffer of std::uint64_t to serialize
+ * \param count Number of std::uint48_t in src
+ * \note For convenience each std::uint48 is read from a std::uint64_t
+ * \return Number of bytes written in buf
+ */
+inline std::size_t SET_ARRAY_UINT48(std::uint8_t* buf, const std::uint64_t* src, const std::size_t count)
+{
+    detail::pack48<Order::LITTLE>(buf, src, count);
+    return count * UINT48_SIZE;
+}
+
+/**
+ * \brief Serialize an array of std::uint48_t in the buffer
+ * \param buf Pointer to the buffer
+ * \param offset Offset in the buffer (in bytes)
+ * \param src ptr to host buffer of std::uint64_t to serialize
+ * \param count Number of std::uint48_t in src
+ * \return Number of bytes written in buf
+ */
+inline std::size_t SET_ARRAY_UINT48(std::uint8_t* buf, const std::size_t offset, const std::uint64_t* src, const std::size_t count)
+{
+    return SET_ARRAY_UINT48(&buf[offset], src, count);
+}
+
+/**
+ * \brief Serialize an array of std::uint48_t in the buffer
+ * \param buf Pointer to the buffer
+ * \param offset Offset in the buffer (in bytes)
+ * \param src ptr to host buffer of std::uint64_t to serialize
+ * \param count Number of std::uint48_t in src
+ * \param length Auto Increment this variable by the number of bytes written
+ * \return Number of bytes written in buf
+ */
+inline std::size_t SET_ARRAY_UINT48(
+    std::uint8_t* buf, const std::size_t offset, const std::uint64_t* src, const std::size_t count, std::size_t& length)
+{
+    const std::size_t written = SET_ARRAY_UINT48(buf, offset, src, count);
+    length += written;
+    return written;
+}
+
+/**
+ * \brief Serialize an array of std::uint64_t in the buffer
+ * \param buf Pointer to the buffer
+ * \param src ptr to host buffer of std::uint64_t to serialize
+ * \param count Number of std::uint64_t in src
+ * \return Number of bytes written in buf
+ */
+inline std::size_t SET_ARRAY_UINT64(std::uint8_t* buf, const std::uint64_t* src, const std::size_t count)
+{
+#ifdef ENDN_IS_BIG_ENDIAN
+    detail::swap_array<std::uint64_t>(buf, src, count);
+#else
+    detail::copy_array(buf, src, count * UINT64_SIZE);
+#endif
+    return count * UINT64_SIZE;
+}
+
+/**
+ * \brief Serialize an array of std::uint64_t in the buffer
+ * \param buf Pointer to the buffer
+ * \param offset Offset in the buffer (in bytes)
+ * \param src ptr to host buffer of std::uint64_t to serialize
+ * \param count Number of std::uint64_t in src
+ * \return Number of bytes written in buf
+ */
+inline std::size_t SET_ARRAY_UINT64(std::uint8_t* buf, const std::size_t offset, const std::uint64_t* src, const std::size_t count)
+{
+    return SET_ARRAY_UINT64(&buf[offset], src, count);
+}
+
+/**
+ * \brief Serialize an array of std::uint64_t in the buffer
+ * \param buf Pointer to the buffer
+ * \param offset Offset in the buffer (in bytes)
+ * \param src ptr to host buffer of std::uint64_t to serialize
+ * \param count Number of std::uint64_t in src
+ * \param length Auto Increment this variable by the number of bytes written
+ * \return Number of bytes written in buf
+ */
+inline std::size_t SET_ARRAY_UINT64(
+    std::uint8_t* buf, const std::size_t offset, const std::uint64_t* src, const std::size_t count, std::size_t& length)
+{
+    const std::size_t written = SET_ARRAY_UINT64(buf, offset, src, count);
+    length += written;
+    return written;
+}
+
+/**
+ * \brief Serialize an array of uint128_t in the buffer
+ * \param buf Pointer to the buffer
+ * \param src ptr to host buffer of uint128_t to serialize
+ * \param count Number of uint128_t in src
+ * \return Number of bytes written in buf
+ */
+inline std::size_t SET_ARRAY_UINT128(std::uint8_t* buf, const uint128_t* src, const std::size_t count)
+{
+#ifdef ENDN_IS_BIG_ENDIAN
+    detail::swap_array<uint128_t>(buf, src, count);
+#else
+    detail::copy_array(buf, src, count * UINT128_SIZE);
+#endif
+    return count * UINT128_SIZE;
+}
+
+/**
+ * \brief Serialize an array of uint128_t in the buffer
+ * \param buf Pointer to the buffer
+ * \param offset Offset in the buffer (in bytes)
+ * \param src ptr to host buffer of uint128_t to serialize
+ * \param count Number of uint128_t in src
+ * \return Number of bytes written in buf
+ */
+inline std::size_t SET_ARRAY_UINT128(std::uint8_t* buf, const std::size_t offset, const uint128_t* src, const std::size_t count)
+{
+    return SET_ARRAY_UINT128(&buf[offset], src, count);
+}
+
+/**
+ * \brief Serialize an array of uint128_t in the buffer
+ * \param buf Pointer to the buffer
+ * \param offset Offset in the buffer (in bytes)
+ * \param src ptr to host buffer of uint128_t to serialize
+ * \param count Number of uint128_t in src
+ * \param length Auto Increment this variable by the number of bytes written
+ * \return Number of bytes written in buf
+ */
+inline std::size_t SET_ARRAY_UINT128(
+    std::uint8_t* buf, const std::size_t offset, const uint128_t* src, const std::size_t count, std::size_t& length)
+{
+    const std::size_t written = SET_ARRAY_UINT128(buf, offset, src, count);
+    length += written;
+    return written;
+}
+
+/**
+ * \brief Serialize an array of int16_t in the buffer
+ * \param buf Pointer to the buffer
+ * \param src ptr to host buffer of int16_t to serialize
+ * \param count Number of int16_t in src
+ * \return Number of bytes written in buf
+ */
+inline std::size_t SET_ARRAY_INT16(std::uint8_t* buf, const int16_t* src, const std::size_t count)
+{
+    return SET_ARRAY_UINT16(buf, reinterpret_cast<const std::uint16_t*>(src), count);
+}
+
+/**
+ * \brief Serialize an array of int16_t in the buffer
+ * \param buf Pointer to the buffer
+ * \param offset Offset in the buffer (in bytes)
+ * \param src ptr to host buffer of int16_t to serialize
+ * \param count Number of int16_t in src
+ * \return Number of bytes written in buf
+ */
+inline std::size_t SET_ARRAY_INT16(std::uint8_t* buf, const std::size_t offset, const int16_t* src, const std::size_t count)
+{
+    return SET_ARRAY_INT16(&buf[offset], src, count);
+}
+
+/**
+ * \brief Serialize an array of int16_t in the buffer
+ * \param buf Pointer to the buffer
+ * \param offset Offset in the buffer (in bytes)
+ * \param src ptr to host buffer of int16_t to serialize
+ * \param count Number of int16_t in src
+ * \param length Auto Increment this variable by the number of bytes written
+ * \return Number of bytes written in buf
+ */
+inline std::size_t SET_ARRAY_INT16(
+    std::uint8_t* buf, const std::size_t offset, const int16_t* src, const std::size_t count, std::size_t& length)
+{
+    const std::size_t written = SET_ARRAY_INT16(buf, offset, src, count);
+    length += written;
+    return written;
+}
+
+/**
+ * \brief Serialize an array of int24_t in the buffer
+ * \param buf Pointer to the buffer
+ * \param src ptr to host buffer of int32_t to serialize
+ * \param count Number of int24_t in src
+ * \note For convenience each int24 is read from a int32_t
+ * \return Number of bytes written in buf
+ */
+inline std::size_t SET_ARRAY_INT24(std::uint8_t* buf, const int32_t* src, const std::size_t count)
+{
+    return SET_ARRAY_UINT24(buf, reinterpret_cast<const std::uint32_t*>(src), count);
+}
+
+/**
+ * \brief Serialize an array of int24_t in the buffer
+ * \param buf Pointer to the buffer
+ * \param offset Offset in the buffer (in bytes)
+ * \param src ptr to host buffer of int32_t to serialize
+ * \param count Number of int24_t in src
+ * \return Number of bytes written in buf
+ */
+inline std::size_t SET_ARRAY_INT24(std::uint8_t* buf, const std::size_t offset, const int32_t* src, const std::size_t count)
+{
+    return SET_ARRAY_INT24(&buf[offset], src, count);
+}
+
+/**
+ * \brief Serialize an array of int24_t in the buffer
+ * \param buf Pointer to the buffer
+ * \param offset Offset in the buffer (in bytes)
+ * \param src ptr to host buffer of int32_t to serialize
+ * \param count Number of int24_t in src
+ * \param length Auto Increment this variable by the number of bytes written
+ * \return Number of bytes written in buf
+ */
+inline std::size_t SET_ARRAY_INT24(
+    std::uint8_t* buf, const std::size_t offset, const int32_t* src, const std::size_t count, std::size_t& length)
+{
+    const std::size_t written = SET_ARRAY_INT24(buf, offset, src, count);
+    length += written;
+    return written;
+}
+
+/**
+ * \brief Serialize an array of int32_t in the buffer
+ * \param buf Pointer to the buffer
+ * \param src ptr to host buffer of int32_t to serialize
+ * \param count Number of int32_t in src
+ * \return Number of bytes written in buf
+ */
+inline std::size_t SET_ARRAY_INT32(std::uint8_t* buf, const int32_t* src, const std::size_t count)
+{
+    return SET_ARRAY_UINT32(buf, reinterpret_cast<const std::uint32_t*>(src), count);
+}
+
+/**
+ * \brief Serialize an array of int32_t in the buffer
+ * \param buf Pointer to the buffer
+ * \param offset Offset in the buffer (in bytes)
+ * \param src ptr to host buffer of int32_t to serialize
+ * \param count Number of int32_t in src
+ * \return Number of bytes written in buf
+ */
+inline std::size_t SET_ARRAY_INT32(std::uint8_t* buf, const std::size_t offset, const int32_t* src, const std::size_t count)
+{
+    return SET_ARRAY_INT32(&buf[offset], src, count);
+}
+
+/**
+ * \brief Serialize an array of int32_t in the buffer
+ * \param buf Pointer to the buffer
+ * \param offset Offset in the buffer (in bytes)
+ * \param src ptr to host buffer of int32_t to serialize
+ * \param count Number of int32_t in src
+ * \param length Auto Increment this variable by the number of bytes written
+ * \return Number of bytes written in buf
+ */
+inline std::size_t SET_ARRAY_INT32(
+    std::uint8_t* buf, const std::size_t offset, const int32_t* src, const std::size_t count, std::size_t& length)
+{
+    const std::size_t written = SET_ARRAY_INT32(buf, offset, src, count);
+    length += written;
+    return written;
+}
+
+/**
+ * \brief Serialize an array of int48_t in the buffer
+ * \param buf Pointer to the buffer
+ * \param src ptr to host buffer of int64_t to serialize
+ * \param count Number of int48_t in src
+ * \note For convenience each int48 is read from a int64_t
+ * \return Number of bytes written in buf
+ */
+inline std::size_t SET_ARRAY_INT48(std::uint8_t* buf, const int64_t* src, const std::size_t count)
+{
+    return SET_ARRAY_UINT48(buf, reinterpret_cast<const std::uint64_t*>(src), count);
+}
+
+/**
+ * \brief Serialize an array of int48_t in the buffer
+ * \param buf Pointer to the buffer
+ * \param offset Offset in the buffer (in bytes)
+ * \param src ptr to host buffer of int64_t to serialize
+ * \param count Number of int48_t in src
+ * \return Number of bytes written in buf
+ */
+inline std::size_t SET_ARRAY_INT48(std::uint8_t* buf, const std::size_t offset, const int64_t* src, const std::size_t count)
+{
+    return SET_ARRAY_INT48(&buf[offset], src, count);
+}
+
+/**
+ * \brief Serialize an array of int48_t in the buffer
+ * \param buf Pointer to the buffer
+ * \param offset Offset in the buffer (in bytes)
+ * \param src ptr to host buffer of int64_t to serialize
+ * \param count Number of int48_t in src
+ * \param length Auto Increment this variable by the number of bytes written
+ * \return Number of bytes written in buf
+ */
+inline std::size_t SET_ARRAY_INT48(
+    std::uint8_t* buf, const std::size_t offset, const int64_t* src, const std::size_t count, std::size_t& length)
+{
+    const std::size_t written = SET_ARRAY_INT48(buf, offset, src, count);
+    length += written;
+    return written;
+}
+
+/**
+ * \brief Serialize an array of int64_t in the buffer
+ * \param buf Pointer to the buffer
+ * \param src ptr to host buffer of int64_t to serialize
+ * \param count Number of int64_t in src
+ * \return Number of bytes written in buf
+ */
+inline std::size_t SET_ARRAY_INT64(std::uint8_t* buf, const int64_t* src, const std::size_t count)
+{
+    return SET_ARRAY_UINT64(buf, reinterpret_cast<const std::uint64_t*>(src), count);
+}
+
+/**
+ * \brief Serialize an array of int64_t in the buffer
+ * \param buf Pointer to the buffer
+ * \param offset Offset in the buffer (in bytes)
+ * \param src ptr to host buffer of int64_t to serialize
+ * \param count Number of int64_t in src
+ * \return Number of bytes written in buf
+ */
+inline std::size_t SET_ARRAY_INT64(std::uint8_t* buf, const std::size_t offset, const int64_t* src, const std::size_t count)
+{
+    return SET_ARRAY_INT64(&buf[offset], src, count);
+}
+
+/**
+ * \brief Serialize an array of int64_t in the buffer
+ * \param buf Pointer to the buffer
+ * \param offset Offset in the buffer (in bytes)
+ * \param src ptr to host buffer of int64_t to serialize
+ * \param count Number of int64_t in src
+ * \param length Auto Increment this variable by the number of bytes written
+ * \return Number of bytes written in buf
+ */
+inline std::size_t SET_ARRAY_INT64(
+    std::uint8_t* buf, const std::size_t offset, const int64_t* src, const std::size_t count, std::size_t& length)
+{
+    const std::size_t written = SET_ARRAY_INT64(buf, offset, src, count);
+    length += written;
+    return written;
+}
+
+/**
+ * \brief memcpy from a little endian float array to a local buffer
+ * \param dest ptr to local float buffer, that contains float
+ * \param src ptr to little endian buffer of float that need to be deserialized in dest
+ * \param count Number of float in src
+ */
+inline void MEMCPY_FLOAT32(float* dest, const std::uint8_t* src, const std::size_t count)
+{
+#ifdef ENDN_IS_BIG_ENDIAN
+    detail::swap_array<std::uint32_t>(dest, src, count);
+#else
+    detail::copy_array(dest, src, count * FLOAT32_SIZE);
+#endif
+}
+
+/**
+ * \brief Convert a little endian binary16 array to a local float buffer
+ * \param dest ptr to local float buffer, that contains float
+ * \param src ptr to little endian buffer of binary16 that need to be converted in dest
+ * \param count Number of binary16 in src
+ */
+inline void MEMCPY_FLOAT16(float* dest, const std::uint8_t* src, const std::size_t count)
+{
+    detail::unpack_float16<Order::LITTLE>(dest, src, count);
+}
+
+/**
+ * \brief Convert a little endian bfloat16 array to a local float buffer
+ * \param dest ptr to local float buffer, that contains float
+ * \param src ptr to little endian buffer of bfloat16 that need to be converted in dest
+ * \param count Number of bfloat16 in src
+ */
+inline void MEMCPY_BFLOAT16(float* dest, const std::uint8_t* src, const std::size_t count)
+{
+    detail::unpack_bfloat16<Order::LITTLE>(dest, src, count);
+}
+
+/**
+ * \brief Serialize an array of float in the buffer
+ * \param buf Pointer to the buffer
+ * \param src ptr to host buffer of float to serialize
+ * \param count Number of float in src
+ * \return Number of bytes written in buf
+ */
+inline std::size_t SET_ARRAY_FLOAT32(std::uint8_t* buf, const float* src, const std::size_t count)
+{
+#ifdef ENDN_IS_BIG_ENDIAN
+    detail::swap_array<std::uint32_t>(buf, src, count);
+#else
+    detail::copy_array(buf, src, count * FLOAT32_SIZE);
+#endif
+    return count * FLOAT32_SIZE;
+}
+
+/**
+ * \brief Serialize an array of float in the buffer
+ * \param buf Pointer to the buffer
+ * \param offset Offset in the buffer (in bytes)
+ * \param src ptr to host buffer of float to serialize
+ * \param count Number of float in src
+ * \return Number of bytes written in buf
+ */
+inline std::size_t SET_ARRAY_FLOAT32(std::uint8_t* buf, const std::size_t offset, const float* src, const std::size_t count)
+{
+    return SET_ARRAY_FLOAT32(&buf[offset], src, count);
+}
+
+/**
+ * \brief Serialize an array of float in the buffer
+ * \param buf Pointer to the buffer
+ * \param offset Offset in the buffer (in bytes)
+ * \param src ptr to host buffer of float to serialize
+ * \param count Number of float in src
+ * \param length Auto Increment this variable by the number of bytes written
+ * \return Number of bytes written in buf
+ */
+inline std::size_t SET_ARRAY_FLOAT32(
+    std::uint8_t* buf, const std::size_t offset, const float* src, const std::size_t count, std::size_t& length)
+{
+    const std::size_t written = SET_ARRAY_FLOAT32(buf, offset, src, count);
+    length += written;
+    return written;
+}
+
+/**
+ * \brief Serialize an array of float as binary16 in the buffer
+ * \param buf Pointer to the buffer
+ * \param src ptr to host buffer of float to serialize
+ * \param count Number of float in src
+ * \return Number of bytes written in buf
+ */
+inline std::size_t SET_ARRAY_FLOAT16(std::uint8_t* buf, const float* src, const std::size_t count)
+{
+    detail::pack_float16<Order::LITTLE>(buf, src, count);
+    return count * FLOAT16_SIZE;
+}
+
+/**
+ * \brief Serialize an array of float as binary16 in the buffer
+ * \param buf Pointer to the buffer
+ * \param offset Offset in the buffer (in bytes)
+ * \param src ptr to host buffer of float to serialize
+ * \param count Number of float in src
+ * \return Number of bytes written in buf
+ */
+inline std::size_t SET_ARRAY_FLOAT16(std::uint8_t* buf, const std::size_t offset, const float* src, const std::size_t count)
+{
+    return SET_ARRAY_FLOAT16(&buf[offset], src, count);
+}
+
+/**
+ * \brief Serialize an array of float as binary16 in the buffer
+ * \param buf Pointer to the buffer
+ * \param offset Offset in the buffer (in bytes)
+ * \param src ptr to host buffer of float to serialize
+ * \param count Number of float in src
+ * \param length Auto Increment this variable by the number of bytes written
+ * \return Number of bytes written in buf
+ */
+inline std::size_t SET_ARRAY_FLOAT16(
+    std::uint8_t* buf, const std::size_t offset, const float* src, const std::size_t count, std::size_t& length)
+{
+    const std::size_t written = SET_ARRAY_FLOAT16(buf, offset, src, count);
+    length += written;
+    return written;
+}
+
+/**
+ * \brief Serialize an array of float as bfloat16 in the buffer
+ * \param buf Pointer to the buffer
+ * \param src ptr to host buffer of float to serialize
+ * \param count Number of float in src
+ * \return Number of bytes written in buf
+ */
+inline std::size_t SET_ARRAY_BFLOAT16(std::uint8_t* buf, const float* src, const std::size_t count)
+{
+    detail::pack_bfloat16<Order::LITTLE>(buf, src, count);
+    return count * BFLOAT16_SIZE;
+}
+
+/**
+ * \brief Serialize an array of float as bfloat16 in the buffer
+ * \param buf Pointer to the buffer
+ * \param offset Offset in the buffer (in bytes)
+ * \param src ptr to host buffer of float to serialize
+ * \param count Number of float in src
+ * \return Number of bytes written in buf
+ */
+inline std::size_t SET_ARRAY_BFLOAT16(std::uint8_t* buf, const std::size_t offset, const float* src, const std::size_t count)
+{
+    return SET_ARRAY_BFLOAT16(&buf[offset], src, count);
+}
+
+/**
+ * \brief Serialize an array of float as bfloat16 in the buffer
+ * \param buf Pointer to the buffer
+ * \param offset Offset in the buffer (in bytes)
+ * \param src ptr to host buffer of float to serialize
+ * \param count Number of float in src
+ * \param length Auto Increment this variable by the number of bytes written
+ * \return Number of bytes written in buf
+ */
+inline std::size_t SET_ARRAY_BFLOAT16(
+    std::uint8_t* buf, const std::size_t offset, const float* src, const std::size_t count, std::size_t& length)
+{
+    const std::size_t written = SET_ARRAY_BFLOAT16(buf, offset, src, count);
+    length += written;
+    return written;
+}
+
+/**
+ * \brief memcpy from a little endian double array to a local buffer
+ * \param dest ptr to local double buffer, that contains double
+ * \param src ptr to little endian buffer of double that need to be deserialized in dest
+ * \param count Number of double in src
+ */
+inline void MEMCPY_FLOAT64(double* dest, const std::uint8_t* src, const std::size_t count)
+{
+#ifdef ENDN_IS_BIG_ENDIAN
+    detail::swap_array<std::uint64_t>(dest, src, count);
+#else
+    detail::copy_array(dest, src, count * FLOAT64_SIZE);
+#endif
+}
+
+/**
+ * \brief Serialize an array of double in the buffer
+ * \param buf Pointer to the buffer
+ * \param src ptr to host buffer of double to serialize
+ * \param count Number of double in src
+ * \return Number of bytes written in buf
+ */
+inline std::size_t SET_ARRAY_FLOAT64(std::uint8_t* buf, const double* src, const std::size_t count)
+{
+#ifdef ENDN_IS_BIG_ENDIAN
+    detail::swap_array<std::uint64_t>(buf, src, count);
+#else
+    detail::copy_array(buf, src, count * FLOAT64_SIZE);
+#endif
+    return count * FLOAT64_SIZE;
+}
+
+/**
+ * \brief Serialize an array of double in the buffer
+ * \param buf Pointer to the buffer
+ * \param offset Offset in the buffer (in bytes)
+ * \param src ptr to host buffer of double to serialize
+ * \param count Number of double in src
+ * \return Number of bytes written in buf
+ */
+inline std::size_t SET_ARRAY_FLOAT64(std::uint8_t* buf, const std::size_t offset, const double* src, const std::size_t count)
+{
+    return SET_ARRAY_FLOAT64(&buf[offset], src, count);
+}
+
+/**
+ * \brief Serialize an array of double in the buffer
+ * \param buf Pointer to the buffer
+ * \param offset Offset in the buffer (in bytes)
+ * \param src ptr to host buffer of double to serialize
+ * \param count Number of double in src
+ * \param length Auto Increment this variable by the number of bytes written
+ * \return Number of bytes written in buf
+ */
+inline std::size_t SET_ARRAY_FLOAT64(
+    std::uint8_t* buf, const std::size_t offset, const double* src, const std::size_t count, std::size_t& length)
+{
+    const std::size_t written = SET_ARRAY_FLOAT64(buf, offset, src, count);
+    length += written;
+    return written;
+}
+
+/**
+ * \brief Convert a little endian fixed point array to a local float or double buffer
+ * \tparam Format Fixed point format (endn::Q15, endn::Q31, endn::Fixed<int32_t, 20>, ...)
+ * \param dest ptr to local float or double buffer
+ * \param src ptr to little endian buffer of fixed point integers that need to be converted in dest
+ * \param count Number of fixed point integers in src
+ */
+template<typename Format, typename T>
+inline void MEMCPY_FIXED(T* dest, const std::uint8_t* src, const std::size_t count)
+{
+    detail::unpack_fixed<Format, Order::LITTLE>(dest, src, count);
+}
+
+/**
+ * \brief Serialize an array of float or double as fixed point in the buffer, saturated to the Format range (NaN give 0)
+ * \tparam Format Fixed point format (endn::Q15, endn::Q31, endn::Fixed<int32_t, 20>, ...)
+ * \param buf Pointer to the buffer
+ * \param src ptr to host buffer of float or double to serialize
+ * \param count Number of values in src
+ * \return Number of bytes written in buf
+ */
+template<typename Format, typename T>
+inline std::size_t SET_ARRAY_FIXED(std::uint8_t* buf, const T* src, const std::size_t count)
+{
+    detail::pack_fixed<Format, Order::LITTLE>(buf, src, count);
+    return count * sizeof(typename Format::type);
+}
+
+/**
+ * \brief Serialize an array of float or double as fixed point in the buffer, saturated to the Format range (NaN give 0)
+ * \tparam Format Fixed point format (endn::Q15, endn::Q31, endn::Fixed<int32_t, 20>, ...)
+ * \param buf Pointer to the buffer
+ * \param offset Offset in the buffer (in bytes)
+ * \param src ptr to host buffer of float or double to serialize
+ * \param count Number of values in src
+ * \return Number of bytes written in buf
+ */
+template<typename Format, typename T>
+inline std::size_t SET_ARRAY_FIXED(std::uint8_t* buf, const std::size_t offset, const T* src, const std::size_t count)
+{
+    return SET_ARRAY_FIXED<Format>(&buf[offset], src, count);
+}
+
+/**
+ * \brief Serialize an array of float or double as fixed point in the buffer, saturated to the Format range (NaN give 0)
+ * \tparam Format Fixed point format (endn::Q15, endn::Q31, endn::Fixed<int32_t, 20>, ...)
+ * \param buf Pointer to the buffer
+ * \param offset Offset in the buffer (in bytes)
+ * \param src ptr to host buffer of float or double to serialize
+ * \param count Number of values in src
+ * \param length Auto Increment this variable by the number of bytes written
+ * \return Number of bytes written in buf
+ */
+template<typename Format, typename T>
+inline std::size_t SET_ARRAY_FIXED(
+    std::uint8_t* buf, const std::size_t offset, const T* src, const std::size_t count, std::size_t& length)
+{
+    const std::size_t written = SET_ARRAY_FIXED<Format>(buf, offset, src, count);
+    length += written;
+    return written;
+}
+
+/**
+ * \brief Convert a little endian array of Wire to a local array of T in a single pass (std::uint16_t to std::uint32_t,
+ * double to float, ...). Integers out of the T range are saturated, finite double too large for a float become infinity.
+ * \tparam Wire Serialized type, integer or floating point like T
+ * \param dest ptr to local T buffer
+ * \param src ptr to little endian buffer of Wire that need to be converted in dest
+ * \param count Number of Wire in src
+ * \return Number of values that didn't fit in T
+ * \note SET_ARRAY_CONVERT return the number of bytes written instead, and report the saturated values through its
+ * saturated parameter
+ */
+template<typename Wire, typename T>
+inline std::size_t MEMCPY_CONVERT(T* dest, const std::uint8_t* src, const std::size_t count)
+{
+    return detail::unpack_convert<Wire, Order::LITTLE>(dest, src, count);
+}
+
+/**
+ * \brief Serialize an array of T as Wire in the buffer in a single pass (std::uint64_t to std::uint32_t, float to double, ...).
+ * Integers out of the Wire range are saturated, finite double too large for a float become infinity.
+ * \tparam Wire Serialized type, integer or floating point like T
+ * \param buf Pointer to the buffer
+ * \param src ptr to host buffer of T to serialize
+ * \param count Number of T in src
+ * \param saturated If not null, incremented by the number of values that didn't fit in Wire
+ * \return Number of bytes written in buf, not the saturated count returned by MEMCPY_CONVERT
+ */
+template<typename Wire, typename T>
+inline std::size_t SET_ARRAY_CONVERT(std::uint8_t* buf, const T* src, const std::size_t count, std::size_t* saturated = nullptr)
+{
+    const std::size_t n = detail::pack_convert<Wire, Order::LITTLE>(buf, src, count);
+    if(saturated)
+        *saturated += n;
+    return count * sizeof(Wire);
+}
+
+/**
+ * \brief Serialize an array of T as Wire in the buffer in a single pass, saturated to the Wire range
+ * \tparam Wire Serialized type, integer or floating point like T
+ * \param buf Pointer to the buffer
+ * \param offset Offset in the buffer (in bytes)
+ * \param src ptr to host buffer of T to serialize
+ * \param count Number of T in src
+ * \param saturated If not null, incremented by the number of values that didn't fit in Wire
+ * \return Number of bytes written in buf
+ */
+template<typename Wire, typename T>
+inline std::size_t SET_ARRAY_CONVERT(
+    std::uint8_t* buf, const std::size_t offset, const T* src, const std::size_t count, std::size_t* saturated = nullptr)
+{
+    return SET_ARRAY_CONVERT<Wire>(&buf[offset], src, count, saturated);
+}
+
+/**
+ * \brief Serialize an array of T as Wire in the buffer in a single pass, saturated to the Wire range
+ * \tparam Wire Serialized type, integer or floating point like T
+ * \param buf Pointer to the buffer
+ * \param offset Offset in the buffer (in bytes)
+ * \param src ptr to host buffer of T to serialize
+ * \param count Number of T in src
+ * \param length Auto Increment this variable by the number of bytes written
+ * \param saturated If not null, incremented by the number of values that didn't fit in Wire
+ * \return Number of bytes written in buf
+ */
+template<typename Wire, typename T>
+inline std::size_t SET_ARRAY_CONVERT(std::uint8_t* buf, const std::size_t offset, const T* src, const std::size_t count,
+    std::size_t& length, std::size_t* saturated = nullptr)
+{
+    const std::size_t written = SET_ARRAY_CONVERT<Wire>(buf, offset, src, count, saturated);
+    length += written;
+    return written;
+}
+
+/**
+ * \brief Extract a std::uint16_t field from an array of fixed size little endian records into a local buffer
+ * \param dest ptr to local std::uint16_t buffer, that will contain count std::uint16_t
+ * \param src ptr to the first record
+ * \param stride Size of a record (in bytes)
+ * \param offset Offset of the field in a record (in bytes)
+ * \param count Number of records
+ */
+inline void EXTRACT_UINT16(
+    std::uint16_t* dest, const std::uint8_t* src, const std::size_t stride, const std::size_t offset, const std::size_t count)
+{
+    detail::extract<Order::LITTLE>(dest, &src[offset], stride, count);
+}
+
+/**
+ * \brief Extract a std::uint32_t field from an array of fixed size little endian records into a local buffer
+ * \param dest ptr to local std::uint32_t buffer, that will contain count std::uint32_t
+ * \param src ptr to the first record
+ * \param stride Size of a record (in bytes)
+ * \param offset Offset of the field in a record (in bytes)
+ * \param count Number of records
+ */
+inline void EXTRACT_UINT32(
+    std::uint32_t* dest, const std::uint8_t* src, const std::size_t stride, const std::size_t offset, const std::size_t count)
+{
+    detail::extract<Order::LITTLE>(dest, &src[offset], stride, count);
+}
+
+/**
+ * \brief Extract a std::uint48_t field from an array of fixed size little endian records into a local buffer
+ * \param dest ptr to local std::uint64_t buffer, that will contain count std::uint64_t
+ * \param src ptr to the first record
+ * \param stride Size of a record (in bytes)
+ * \param offset Offset of the field in a record (in bytes)
+ * \param count Number of records
+ * \note For convenience each std::uint48_t is stored in a std::uint64_t
+ */
+inline void EXTRACT_UINT48(
+    std::uint64_t* dest, const std::uint8_t* src, const std::size_t stride, const std::size_t offset, const std::size_t count)
+{
+    detail::extract48<Order::LITTLE, false>(dest, &src[offset], stride, count);
+}
+
+/**
+ * \brief Extract a std::uint64_t field from an array of fixed size little endian records into a local buffer
+ * \param dest ptr to local std::uint64_t buffer, that will contain count std::uint64_t
+ * \param src ptr to the first record
+ * \param stride Size of a record (in bytes)
+ * \param offset Offset of the field in a record (in bytes)
+ * \param count Number of records
+ */
+inline void EXTRACT_UINT64(
+    std::uint64_t* dest, const std::uint8_t* src, const std::size_t stride, const std::size_t offset, const std::size_t count)
+{
+    detail::extract<Order::LITTLE>(dest, &src[offset], stride, count);
+}
+
+/**
+ * \brief Extract a int16_t field from an array of fixed size little endian records into a local buffer
+ * \param dest ptr to local int16_t buffer, that will contain count int16_t
+ * \param src ptr to the first record
+ * \param stride Size of a record (in bytes)
+ * \param offset Offset of the field in a record (in bytes)
+ * \param count Number of records
+ */
+inline void EXTRACT_INT16(
+    int16_t* dest, const std::uint8_t* src, const std::size_t stride, const std::size_t offset, const std::size_t count)
+{
+    detail::extract<Order::LITTLE>(reinterpret_cast<std::uint16_t*>(dest), &src[offset], stride, count);
+}
+
+/**
+ * \brief Extract a int32_t field from an array of fixed size little endian records into a local buffer
+ * \param dest ptr to local int32_t buffer, that will contain count int32_t
+ * \param src ptr to the first record
+ * \param stride Size of a record (in bytes)
+ * \param offset Offset of the field in a record (in bytes)
+ * \param count Number of records
+ */
+inline void EXTRACT_INT32(
+    int32_t* dest, const std::uint8_t* src, const std::size_t stride, const std::size_t offset, const std::size_t count)
+{
+    detail::extract<Order::LITTLE>(reinterpret_cast<std::uint32_t*>(dest), &src[offset], stride, count);
+}
+
+/**
+ * \brief Extract a int48_t field from an array of fixed size little endian records into a local buffer
+ * \param dest ptr to local int64_t buffer, that will contain count int64_t
+ * \param src ptr to the first record
+ * \param stride Size of a record (in bytes)
+ * \param offset Offset of the field in a record (in bytes)
+ * \param count Number of records
+ * \note For convenience each int48_t is stored in a int64_t
+ */
+inline void EXTRACT_INT48(
+    int64_t* dest, const std::uint8_t* src, const std::size_t stride, const std::size_t offset, const std::size_t count)
+{
+    detail::extract48<Order::LITTLE, true>(reinterpret_cast<std::uint64_t*>(dest), &src[offset], stride, count);
+}
+
+/**
+ * \brief Extract a int64_t field from an array of fixed size little endian records into a local buffer
+ * \param dest ptr to local int64_t buffer, that will contain count int64_t
+ * \param src ptr to the first record
+ * \param stride Size of a record (in bytes)
+ * \param offset Offset of the field in a record (in bytes)
+ * \param count Number of records
+ */
+inline void EXTRACT_INT64(
+    int64_t* dest, const std::uint8_t* src, const std::size_t stride, const std::size_t offset, const std::size_t count)
+{
+    detail::extract<Order::LITTLE>(reinterpret_cast<std::uint64_t*>(dest), &src[offset], stride, count);
+}
+
+/**
+ * \brief Extract a float field from an array of fixed size little endian records into a local buffer
+ * \param dest ptr to local float buffer, that will contain count float
+ * \param src ptr to the first record
+ * \param stride Size of a record (in bytes)
+ * \param offset Offset of the field in a record (in bytes)
+ * \param count Number of records
+ */
+inline void EXTRACT_FLOAT32(
+    float* dest, const std::uint8_t* src, const std::size_t stride, const std::size_t offset, const std::size_t count)
+{
+    detail::extract<Order::LITTLE>(reinterpret_cast<std::uint32_t*>(dest), &src[offset], stride, count);
+}
+
+/**
+ * \brief Extract a double field from an array of fixed size little endian records into a local buffer
+ * \param dest ptr to local double buffer, that will contain count double
+ * \param src ptr to the first record
+ * \param stride Size of a record (in bytes)
+ * \param offset Offset of the field in a record (in bytes)
+ * \param count Number of records
+ */
+inline void EXTRACT_FLOAT64(
+    double* dest, const std::uint8_t* src, const std::size_t stride, const std::size_t offset, const std::size_t count)
+{
+    detail::extract<Order::LITTLE>(reinterpret_cast<std::uint64_t*>(dest), &src[offset], stride, count);
+}
+
+/**
+ * \brief Gather std::uint16_t little endian fields at arbitrary offsets of a buffer into a local buffer
+ * \param dest ptr to local std::uint16_t buffer, that will contain count std::uint16_t
+ * \param src ptr to the buffer
+ * \param offsets Offset of each field in src (in bytes)
+ * \param count Number of fields
+ */
+inline void GATHER_UINT16(std::uint16_t* dest, const std::uint8_t* src, const std::size_t* offsets, const std::size_t count)
+{
+    detail::gather<Order::LITTLE>(dest, src, offsets, count);
+}
+
+/**
+ * \brief Gather std::uint32_t little endian fields at arbitrary offsets of a buffer into a local buffer
+ * \param dest ptr to local std::uint32_t buffer, that will contain count std::uint32_t
+ * \param src ptr to the buffer
+ * \param offsets Offset of each field in src (in bytes)
+ * \param count Number of fields
+ */
+inline void GATHER_UINT32(std::uint32_t* dest, const std::uint8_t* src, const std::size_t* offsets, const std::size_t count)
+{
+    detail::gather<Order::LITTLE>(dest, src, offsets, count);
+}
+
+/**
+ * \brief Gather std::uint64_t little endian fields at arbitrary offsets of a buffer into a local buffer
+ * \param dest ptr to local std::uint64_t buffer, that will contain count std::uint64_t
+ * \param src ptr to the buffer
+ * \param offsets Offset of each field in src (in bytes)
+ * \param count Number of fields
+ */
+inline void GATHER_UINT64(std::uint64_t* dest, const std::uint8_t* src, const std::size_t* offsets, const std::size_t count)
+{
+    detail::gather<Order::LITTLE>(dest, src, offsets, count);
+}
+
+/**
+ * \brief Gather int16_t little endian fields at arbitrary offsets of a buffer into a local buffer
+ * \param dest ptr to local int16_t buffer, that will contain count int16_t
+ * \param src ptr to the buffer
+ * \param offsets Offset of each field in src (in bytes)
+ * \param count Number of fields
+ */
+inline void GATHER_INT16(int16_t* dest, const std::uint8_t* src, const std::size_t* offsets, const std::size_t count)
+{
+    detail::gather<Order::LITTLE>(reinterpret_cast<std::uint16_t*>(dest), src, offsets, count);
+}
+
+/**
+ * \brief Gather int32_t little endian fields at arbitrary offsets of a buffer into a local buffer
+ * \param dest ptr to local int32_t buffer, that will contain count int32_t
+ * \param src ptr to the buffer
+ * \param offsets Offset of each field in src (in bytes)
+ * \param count Number of fields
+ */
+inline void GATHER_INT32(int32_t* dest, const std::uint8_t* src, const std::size_t* offsets, const std::size_t count)
+{
+    detail::gather<Order::LITTLE>(reinterpret_cast<std::uint32_t*>(dest), src, offsets, count);
+}
+
+/**
+ * \brief Gather int64_t little endian fields at arbitrary offsets of a buffer into a local buffer
+ * \param dest ptr to local int64_t buffer, that will contain count int64_t
+ * \param src ptr to the buffer
+ * \param offsets Offset of each field in src (in bytes)
+ * \param count Number of fields
+ */
+inline void GATHER_INT64(int64_t* dest, const std::uint8_t* src, const std::size_t* offsets, const std::size_t count)
+{
+    detail::gather<Order::LITTLE>(reinterpret_cast<std::uint64_t*>(dest), src, offsets, count);
+}
+
+/**
+ * \brief Gather float little endian fields at arbitrary offsets of a buffer into a local buffer
+ * \param dest ptr to local float buffer, that will contain count float
+ * \param src ptr to the buffer
+ * \param offsets Offset of each field in src (in bytes)
+ * \param count Number of fields
+ */
+inline void GATHER_FLOAT32(float* dest, const std::uint8_t* src, const std::size_t* offsets, const std::size_t count)
+{
+    detail::gather<Order::LITTLE>(reinterpret_cast<std::uint32_t*>(dest), src, offsets, count);
+}
+
+/**
+ * \brief Gather double little endian fields at arbitrary offsets of a buffer into a local buffer
+ * \param dest ptr to local double buffer, that will contain count double
+ * \param src ptr to the buffer
+ * \param offsets Offset of each field in src (in bytes)
+ * \param count Number of fields
+ */
+inline void GATHER_FLOAT64(double* dest, const std::uint8_t* src, const std::size_t* offsets, const std::size_t count)
+{
+    detail::gather<Order::LITTLE>(reinterpret_cast<std::uint64_t*>(dest), src, offsets, count);
+}
+
+/**
+ * \brief Serialize a local buffer into a std::uint16_t field of an array of fixed size little endian records
+ * \param dest ptr to the first record
+ * \param stride Size of a record (in bytes)
+ * \param offset Offset of the field in a record (in bytes)
+ * \param src ptr to local std::uint16_t buffer, that contains count std::uint16_t
+ * \param count Number of records
+ */
+inline void SCATTER_UINT16(
+    std::uint8_t* dest, const std::size_t stride, const std::size_t offset, const std::uint16_t* src, const std::size_t count)
+{
+    detail::scatter<std::uint16_t, Order::LITTLE>(&dest[offset], stride, src, count);
+}
+
+/**
+ * \brief Serialize a local buffer into a std::uint32_t field of an array of fixed size little endian records
+ * \param dest ptr to the first record
+ * \param stride Size of a record (in bytes)
+ * \param offset Offset of the field in a record (in bytes)
+ * \param src ptr to local std::uint32_t buffer, that contains count std::uint32_t
+ * \param count Number of records
+ */
+inline void SCATTER_UINT32(
+    std::uint8_t* dest, const std::size_t stride, const std::size_t offset, const std::uint32_t* src, const std::size_t count)
+{
+    detail::scatter<std::uint32_t, Order::LITTLE>(&dest[offset], stride, src, count);
+}
+
+/**
+ * \brief Serialize a local buffer into a std::uint48_t field of an array of fixed size little endian records
+ * \param dest ptr to the first record
+ * \param stride Size of a record (in bytes)
+ * \param offset Offset of the field in a record (in bytes)
+ * \param src ptr to local std::uint64_t buffer, that contains count std::uint64_t
+ * \param count Number of records
+ * \note For convenience each std::uint48_t is read from a std::uint64_t
+ */
+inline void SCATTER_UINT48(
+    std::uint8_t* dest, const std::size_t stride, const std::size_t offset, const std::uint64_t* src, const std::size_t count)
+{
+    detail::scatter48<Order::LITTLE>(&dest[offset], stride, src, count);
+}
+
+/**
+ * \brief Serialize a local buffer into a std::uint64_t field of an array of fixed size little endian records
+ * \param dest ptr to the first record
+ * \param stride Size of a record (in bytes)
+ * \param offset Offset of the field in a record (in bytes)
+ * \param src ptr to local std::uint64_t buffer, that contains count std::uint64_t
+ * \param count Number of records
+ */
+inline void SCATTER_UINT64(
+    std::uint8_t* dest, const std::size_t stride, const std::size_t offset, const std::uint64_t* src, const std::size_t count)
+{
+    detail::scatter<std::uint64_t, Order::LITTLE>(&dest[offset], stride, src, count);
+}
+
+/**
+ * \brief Serialize a local buffer into a int16_t field of an array of fixed size little endian records
+ * \param dest ptr to the first record
+ * \param stride Size of a record (in bytes)
+ * \param offset Offset of the field in a record (in bytes)
+ * \param src ptr to local int16_t buffer, that contains count int16_t
+ * \param count Number of records
+ */
+inline void SCATTER_INT16(
+    std::uint8_t* dest, const std::size_t stride, const std::size_t offset, const int16_t* src, const std::size_t count)
+{
+    detail::scatter<std::uint16_t, Order::LITTLE>(&dest[offset], stride, reinterpret_cast<const std::uint16_t*>(src), count);
+}
+
+/**
+ * \brief Serialize a local buffer into a int32_t field of an array of fixed size little endian records
+ * \param dest ptr to the first record
+ * \param stride Size of a record (in bytes)
+ * \param offset Offset of the field in a record (in bytes)
+ * \param src ptr to local int32_t buffer, that contains count int32_t
+ * \param count Number of records
+ */
+inline void SCATTER_INT32(
+    std::uint8_t* dest, const std::size_t stride, const std::size_t offset, const int32_t* src, const std::size_t count)
+{
+    detail::scatter<std::uint32_t, Order::LITTLE>(&dest[offset], stride, reinterpret_cast<const std::uint32_t*>(src), count);
+}
+
+/**
+ * \brief Serialize a local buffer into a int48_t field of an array of fixed size little endian records
+ * \param dest ptr to the first record
+ * \param stride Size of a record (in bytes)
+ * \param offset Offset of the field in a record (in bytes)
+ * \param src ptr to local int64_t buffer, that contains count int64_t
+ * \param count Number of records
+ * \note For convenience each int48_t is read from a int64_t
+ */
+inline void SCATTER_INT48(
+    std::uint8_t* dest, const std::size_t stride, const std::size_t offset, const int64_t* src, const std::size_t count)
+{
+    detail::scatter48<Order::LITTLE>(&dest[offset], stride, reinterpret_cast<const std::uint64_t*>(src), count);
+}
+
+/**
+ * \brief Serialize a local buffer into a int64_t field of an array of fixed size little endian records
+ * \param dest ptr to the first record
+ * \param stride Size of a record (in bytes)
+ * \param offset Offset of the field in a record (in bytes)
+ * \param src ptr to local int64_t buffer, that contains count int64_t
+ * \param count Number of records
+ */
+inline void SCATTER_INT64(
+    std::uint8_t* dest, const std::size_t stride, const std::size_t offset, const int64_t* src, const std::size_t count)
+{
+    detail::scatter<std::uint64_t, Order::LITTLE>(&dest[offset], stride, reinterpret_cast<const std::uint64_t*>(src), count);
+}
+
+/**
+ * \brief Serialize a local buffer into a float field of an array of fixed size little endian records
+ * \param dest ptr to the first record
+ * \param stride Size of a record (in bytes)
+ * \param offset Offset of the field in a record (in bytes)
+ * \param src ptr to local float buffer, that contains count float
+ * \param count Number of records
+ */
+inline void SCATTER_FLOAT32(
+    std::uint8_t* dest, const std::size_t stride, const std::size_t offset, const float* src, const std::size_t count)
+{
+    detail::scatter<std::uint32_t, Order::LITTLE>(&dest[offset], stride, reinterpret_cast<const std::uint32_t*>(src), count);
+}
+
+/**
+ * \brief Serialize a local buffer into a double field of an array of fixed size little endian records
+ * \param dest ptr to the first record
+ * \param stride Size of a record (in bytes)
+ * \param offset Offset of the field in a record (in bytes)
+ * \param src ptr to local double buffer, that contains count double
+ * \param count Number of records
+ */
+inline void SCATTER_FLOAT64(
+    std::uint8_t* dest, const std::size_t stride, const std::size_t offset, const double* src, const std::size_t count)
+{
+    detail::scatter<std::uint64_t, Order::LITTLE>(&dest[offset], stride, reinterpret_cast<const std::uint64_t*>(src), count);
+}
+
+/**
+ * \brief Serialize several local buffers into the fields of an array of fixed size little endian records
+ * Records are filled by small blocks, every column is written in a block before moving to the next one.
+ * \param dest ptr to the first record
+ * \param stride Size of a record (in bytes)
+ * \param count Number of records
+ * \param columns Description of each field and the local buffer that contains its count values
+ * \param columnCount Number of columns
+ */
+inline void SCATTER_COLUMNS(
+    std::uint8_t* dest, const std::size_t stride, const std::size_t count, const Column* columns, const std::size_t columnCount)
+{
+    detail::scatter_columns<Order::LITTLE>(dest, stride, count, columns, columnCount);
+}
+
+/**
+ * \brief Deserialize an std::uint8_t from buffer
+ * \param buf Pointer to the std::uint8_t
+ * \return The deserialized data
+ */
+inline std::uint8_t GET_UINT8(const char* buf)
+{
+    return load<std::uint8_t, Order::LITTLE>(buf);
+}
+
+/**
+ * \brief Deserialize an std::uint16_t from buffer
+ * \param buf Pointer to the std::uint16_t
+ * \return The deserialized data
+ */
+inline std::uint16_t GET_UINT16(const char* buf)
+{
+    return load<std::uint16_t, Order::LITTLE>(buf);
+}
+
+/**
+ * \brief Deserialize an std::uint24_t from buffer.
+ * \note It is return on a std::uint32_t for convenience
+ * \param buf Pointer to the std::uint24_t
+ * \return The deserialized data
+ */
+inline std::uint32_t GET_UINT24(const char* buf)
+{
+    return load<std::uint32_t, Order::LITTLE, UINT24_SIZE>(buf);
+}
+
+/**
+ * \brief Deserialize an std::uint32_t from buffer
+ * \param buf Pointer to the std::uint32_t
+ * \return The deserialized data
+ */
+inline std::uint32_t GET_UINT32(const char* buf)
+{
+    return load<std::uint32_t, Order::LITTLE>(buf);
+}
+
+/**
+ * \brief Deserialize an std::uint48_t from buffer.
+ * \note It is return on a std::uint64_t for convenience
+ * \param buf Pointer to the std::uint48_t
+ * \return The deserialized data
+ */
+inline std::uint64_t GET_UINT48(const char* buf)
+{
+    return load<std::uint64_t, Order::LITTLE, UINT48_SIZE>(buf);
+}
+
+/**
+ * \brief Deserialize an std::uint64_t from buffer
+ * \param buf Pointer to the std::uint64_t
+ * \return The deserialized data
+ */
+inline std::uint64_t GET_UINT64(const char* buf)
+{
+    return load<std::uint64_t, Order::LITTLE>(buf);
+}
+
+/**
+ * \brief Deserialize an uint128_t from buffer
+ * \param buf Pointer to the uint128_t
+ * \return The deserialized data
+ */
+inline uint128_t GET_UINT128(const char* buf)
+{
+    return load_uint128<Order::LITTLE>(buf);
+}
+
+/**
+ * \brief Deserialize an int8_t from buffer
+ * \param buf Pointer to the int8_t
+ * \return The deserialized data
+ */
+inline int8_t GET_INT8(const char* buf)
+{
+    return load<int8_t, Order::LITTLE>(buf);
+}
+
+/**
+ * \brief Deserialize an int16_t from buffer
+ * \param buf Pointer to the int16_t
+ * \return The deserialized data
+ */
+inline int16_t GET_INT16(const char* buf)
+{
+    return load<int16_t, Order::LITTLE>(buf);
+}
+
+/**
+ * \brief Deserialize an int24_t from buffer.
+ * \note It is return on a int32_t for convenience
+ * \param buf Pointer to the std::uint24_t
+ * \return The deserialized data
+ */
+inline int32_t GET_INT24(const char* buf)
+{
+    return load<int32_t, Order::LITTLE, INT24_SIZE>(buf);
+}
+
+/**
+ * \brief Deserialize an int32_t from buffer
+ * \param buf Pointer to the int32_t
+ * \return The deserialized data
+ */
+inline int32_t GET_INT32(const char* buf)
+{
+    return load<int32_t, Order::LITTLE>(buf);
+}
+
+/**
+ * \brief Deserialize an int48_t from buffer.
+ * \note It is return on a int64_t for convenience
+ * \param buf Pointer to the std::uint48_t
+ * \return The deserialized data
+ */
+inline int64_t GET_INT48(const char* buf)
+{
+    return load<int64_t, Order::LITTLE, INT48_SIZE>(buf);
+}
+
+/**
+ * \brief Deserialize an int64_t from buffer
+ * \param buf Pointer to the int64_t
+ * \return The deserialized data
+ */
+inline int64_t GET_INT64(const char* buf)
+{
+    return load<int64_t, Order::LITTLE>(buf);
+}
+
+/**
+ * \brief Deserialize an float from buffer
+ * \param buf Pointer to the float
+ * \return The deserialized data
+ */
+inline float GET_FLOAT32(const char* buf)
+{
+    return load<float, Order::LITTLE>(buf);
+}
+
+/**
+ * \brief Deserialize a binary16 float from buffer
+ * \param buf Pointer to the binary16 float
+ * \return The deserialized data
+ */
+inline float GET_FLOAT16(const char* buf)
+{
+    return load_float16<Order::LITTLE>(buf);
+}
+
+/**
+ * \brief Deserialize a bfloat16 from buffer
+ * \param buf Pointer to the bfloat16
+ * \return The deserialized data
+ */
+inline float GET_BFLOAT16(const char* buf)
+{
+    return load_bfloat16<Order::LITTLE>(buf);
+}
+
+/**
+ * \brief Deserialize an double from buffer
+ * \param buf Pointer to the double
+ * \return The deserialized data
+ */
+inline double GET_FLOAT64(const char* buf)
+{
+    return load<double, Order::LITTLE>(buf);
+}
+
+/**
+ * \brief Deserialize an std::uint8_t from buffer
+ * \param buf Pointer to the buffer
+ * \param offset Offset in the buffer to access to an std::uint8_t* (in bytes)
+ * \return The deserialized data
+ */
+inline std::uint8_t GET_UINT8(const char* buf, const std::size_t offset)
+{
+    return load<std::uint8_t, Order::LITTLE>(buf, offset);
+}
+
+/**
+ * \brief Deserialize an std::uint16_t from buffer
+ * \param buf Pointer to the buffer
+ * \param offset Offset in the buffer to access to an std::uint16_t* (in bytes)
+ * \return The deserialized data
+ */
+inline std::uint16_t GET_UINT16(const char* buf, const std::size_t offset)
+{
+    return load<std::uint16_t, Order::LITTLE>(buf, offset);
+}
+
+/**
+ * \brief Deserialize an std::uint24_t from buffer
+ * \param buf Pointer to the buffer
+ * \param offset Offset in the buffer to access to an std::uint24_t* (in bytes)
+ * \note Store in a std::uint32_t for convenience
+ * \return The deserialized data
+ */
+inline std::uint32_t GET_UINT24(const char* buf, const std::size_t offset)
+{
+    return load<std::uint32_t, Order::LITTLE, UINT24_SIZE>(buf, offset);
+}
+
+/**
+ * \brief Deserialize an std::uint32_t from buffer
+ * \param buf Pointer to the buffer
+ * \param offset Offset in the buffer to access to an std::uint32_t* (in bytes)
+ * \return The deserialized data
+ */
+inline std::uint32_t GET_UINT32(const char* buf, const std::size_t offset)
+{
+    return load<std::uint32_t, Order::LITTLE>(buf, offset);
+}
+
+/**
+ * \brief Deserialize an std::uint48_t from buffer
+ * \param buf Pointer to the buffer
+ * \param offset Offset in the buffer to access to an std::uint48_t* (in bytes)
+ * \note Store in a std::uint64_t for convenience
+ * \return The deserialized data
+ */
+inline std::uint64_t GET_UINT48(const char* buf, const std::size_t offset)
+{
+    return load<std::uint64_t, Order::LITTLE, UINT48_SIZE>(buf, offset);
+}
+
+/**
+ * \brief Deserialize an std::uint64_t from buffer
+ * \param buf Pointer to the buffer
+ * \param offset Offset in the buffer to access to an std::uint64_t* (in bytes)
+ * \return The deserialized data
+ */
+inline std::uint64_t GET_UINT64(const char* buf, const std::size_t offset)
+{
+    return load<std::uint64_t, Order::LITTLE>(buf, offset);
+}
+
+/**
+ * \brief Deserialize an uint128_t from buffer
+ * \param buf Pointer to the buffer
+ * \param offset Offset in the buffer to access to an uint128_t* (in bytes)
+ * \return The deserialized data
+ */
+inline uint128_t GET_UINT128(const char* buf, const std::size_t offset)
+{
+    return load_uint128<Order::LITTLE>(buf, offset);
+}
+
+/**
+ * \brief Deserialize an int8_t from buffer
+ * \param buf Pointer to the buffer
+ * \param offset Offset in the buffer to access to an int8_t* (in bytes)
+ * \return The deserialized data
+ */
+inline int8_t GET_INT8(const char* buf, const std::size_t offset)
+{
+    return load<int8_t, Order::LITTLE>(buf, offset);
+}
+
+/**
+ * \brief Deserialize an int16_t from buffer
+ * \param buf Pointer to the buffer
+ * \param offset Offset in the buffer to access to an int16_t* (in bytes)
+ * \return The deserialized data
+ */
+inline int16_t GET_INT16(const char* buf, const std::size_t offset)
+{
+    return load<int16_t, Order::LITTLE>(buf, offset);
+}
+
+/**
+ * \brief Deserialize an int24_t from buffer
+ * \param buf Pointer to the buffer
+ * \param offset Offset in the buffer to access to an int24_t* (in bytes)
+ * \note Store in a int32_t for convenience
+ * \return The deserialized data
+ */
+inline int32_t GET_INT24(const char* buf, const std::size_t offset)
+{
+    return load<int32_t, Order::LITTLE, INT24_SIZE>(buf, offset);
+}
+
+/**
+ * \brief Deserialize an int32_t from buffer
+ * \param buf Pointer to the buffer
+ * \param offset Offset in the buffer to access to an int32_t* (in bytes)
+ * \return The deserialized data
+ */
+inline int32_t GET_INT32(const char* buf, const std::size_t offset)
+{
+    return load<int32_t, Order::LITTLE>(buf, offset);
+}
+
+/**
+ * \brief Deserialize an int48_t from buffer
+ * \param buf Pointer to the buffer
+ * \param offset Offset in the buffer to access to an int48_t* (in bytes)
+ * \note Store in a int64_t for convenience
+ * \return The deserialized data
+ */
+inline int64_t GET_INT48(const char* buf, const std::size_t offset)
+{
+    return load<int64_t, Order::LITTLE, INT48_SIZE>(buf, offset);
+}
+
+/**
+ * \brief Deserialize an int64_t from buffer
+ * \param buf Pointer to the buffer
+ * \param offset Offset in the buffer to access to an int64_t* (in bytes)
+ * \return The deserialized data
+ */
+inline int64_t GET_INT64(const char* buf, const std::size_t offset)
+{
+    return load<int64_t, Order::LITTLE>(buf, offset);
+}
+
+/**
+ * \brief Deserialize an float from buffer
+ * \param buf Pointer to the buffer
+ * \param offset Offset in the buffer to access to an float* (in bytes)
+ * \return The deserialized data
+ */
+inline float GET_FLOAT32(const char* buf, const std::size_t offset)
+{
+    return load<float, Order::LITTLE>(buf, offset);
+}
+
+/**
+ * \brief Deserialize a binary16 float from buffer
+ * \param buf Pointer to the buffer
+ * \param offset Offset in the buffer to access to a binary16 float (in bytes)
+ * \return The deserialized data
+ */
+inline float GET_FLOAT16(const char* buf, const std::size_t offset)
+{
+    return load_float16<Order::LITTLE>(buf, offset);
+}
+
+/**
+ * \brief Deserialize a bfloat16 from buffer
  * \param buf Pointer to the buffer
- * \param offset Offset in the buffer (in bytes)
- * \param length Auto Increment this variable by the size of float
- * \param val Value to serialize
+ * \param offset Offset in the buffer to access to a bfloat16 (in bytes)
+ * \return The deserialized data
  */
-inline void SET_FLOAT32(std::uint8_t* buf, const std::size_t offset, const float val, std::size_t& length)
+inline float GET_BFLOAT16(const char* buf, const std::size_t offset)
 {
-    SET_FLOAT32(buf, offset, val);
-    length += UINT32_SIZE;
+    return load_bfloat16<Order::LITTLE>(buf, offset);
 }
 
 /**
- * \brief Serialize a double in the buffer
+ * \brief Deserialize an double from buffer
  * \param buf Pointer to the buffer
- * \param offset Offset in the buffer (in bytes)
- * \param length Auto Increment this variable by the size of double
- * \param val Value to serialize
+ * \param offset Offset in the buffer to access to an double  (in bytes)
+ * \return The deserialized data
  */
-inline void SET_FLOAT64(std::uint8_t* buf, const std::size_t offset, const double val, std::size_t& length)
+inline double GET_FLOAT64(const char* buf, const std::size_t offset)
 {
-    SET_FLOAT64(buf, offset, val);
-    length += UINT64_SIZE;
+    return load<double, Order::LITTLE>(buf, offset);
 }
 
 /**
- * \brief memcpy from a little endian 16 bits to a local buffer
- * \param dest ptr to local std::uint16_t buffer, that contains std::uint16_t
- * \param src ptr to little endian buffer of std::uint16_t that need to be deserialized in dest
- * \param count Number of std::uint16_t in src
+ * \brief Deserialize an std::uint24_t from a padded buffer, with a single 4 bytes load whatever the alignment
+ * \param buf Pointer to the std::uint24_t, followed by at least 1 readable byte
+ * \return The deserialized data
  */
-inline void MEMCPY_UINT16(std::uint16_t* dest, const std::uint8_t* src, const std::size_t count)
+inline std::uint32_t GET_UINT24_PADDED(const char* buf)
 {
-#ifdef ENDN_IS_BIG_ENDIAN
-    if(IS_16_ALIGNED(src))
-    {
-        for(int i = 0; i < count; i += 2)
-            dest[i] = GET_UINT16(src, i);
-        return;
-    }
-#endif
-    if(OVERLAP(std::uintptr_t(dest), std::uintptr_t(src), count * 2))
-        memmove(dest, src, count * 2);
-    else
-        memcpy(dest, src, count * 2);
+    return load_padded<std::uint32_t, Order::LITTLE, UINT24_SIZE>(buf);
 }
 
 /**
- * \brief memcpy from a little endian 32 bits to a local buffer
- * \param dest ptr to local std::uint32_t buffer, that contains std::uint32_t
- * \param src ptr to little endian buffer of std::uint32_t that need to be deserialized in dest
- * \param count Number of std::uint32_t in src
+ * \brief Deserialize an std::uint48_t from a padded buffer, with a single 8 bytes load whatever the alignment
+ * \param buf Pointer to the std::uint48_t, followed by at least 2 readable bytes
+ * \return The deserialized data
  */
-inline void MEMCPY_UINT32(std::uint32_t* dest, const std::uint8_t* src, const std::size_t count)
+inline std::uint64_t GET_UINT48_PADDED(const char* buf)
 {
-#ifdef ENDN_IS_BIG_ENDIAN
-    if(IS_32_ALIGNED(src))
-    {
-        for(int i = 0; i < count; i += 4)
-            dest[i] = GET_UINT32(src, i);
-        return;
-    }
-#endif
-    if(OVERLAP(std::uintptr_t(dest), std::uintptr_t(src), count * 4))
-        memmove(dest, src, count * 4);
-    else
-        memcpy(dest, src, count * 4);
+    return load_padded<std::uint64_t, Order::LITTLE, UINT48_SIZE>(buf);
 }
 
 /**
- * \brief memcpy from a little endian 64 bits to a local buffer
- * \param dest ptr to local std::uint64_t buffer, that contains std::uint64_t
- * \param src ptr to little endian buffer of std::uint64_t that need to be deserialized in dest
- * \param count Number of std::uint64_t in src
+ * \brief Deserialize an std::uint24_t from a padded buffer, with a single 4 bytes load whatever the alignment
+ * \param buf Pointer to the buffer, at least 1 byte must be readable after the std::uint24_t
+ * \param offset Offset in the buffer to access to an std::uint24_t (in bytes)
+ * \return The deserialized data
  */
-inline void MEMCPY_UINT64(std::uint64_t* dest, const std::uint8_t* src, const std::size_t count)
+inline std::uint32_t GET_UINT24_PADDED(const char* buf, const std::size_t offset)
 {
-#ifdef ENDN_IS_BIG_ENDIAN
-    if(IS_64_ALIGNED(src))
-    {
-        for(int i = 0; i < count; i += 8)
-            dest[i] = GET_UINT64(src, i);
-        return;
-    }
-#endif
-    if(OVERLAP(std::uintptr_t(dest), std::uintptr_t(src), count * 8))
-        memmove(dest, src, count * 8);
-    else
-        memcpy(dest, src, count * 8);
+    return load_padded<std::uint32_t, Order::LITTLE, UINT24_SIZE>(buf, offset);
 }
 
 /**
- * \brief Deserialize an std::uint8_t from buffer
- * \param buf Pointer to the std::uint8_t
+ * \brief Deserialize an std::uint48_t from a padded buffer, with a single 8 bytes load whatever the alignment
+ * \param buf Pointer to the buffer, at least 2 bytes must be readable after the std::uint48_t
+ * \param offset Offset in the buffer to access to an std::uint48_t (in bytes)
  * \return The deserialized data
  */
-inline std::uint8_t GET_UINT8(const char* buf)
+inline std::uint64_t GET_UINT48_PADDED(const char* buf, const std::size_t offset)
 {
-    return GET_UINT8((const std::uint8_t*)buf);
+    return load_padded<std::uint64_t, Order::LITTLE, UINT48_SIZE>(buf, offset);
 }
 
 /**
- * \brief Deserialize an std::uint16_t from buffer
- * \param buf Pointer to the std::uint16_t
+ * \brief Deserialize an int24_t from a padded buffer, with a single 4 bytes load whatever the alignment
+ * \param buf Pointer to the int24_t, followed by at least 1 readable byte
  * \return The deserialized data
  */
-inline std::uint16_t GET_UINT16(const char* buf)
+inline int32_t GET_INT24_PADDED(const char* buf)
 {
-    return GET_UINT16((const std::uint8_t*)buf);
+    return load_padded<int32_t, Order::LITTLE, INT24_SIZE>(buf);
 }
 
 /**
- * \brief Deserialize an std::uint32_t from buffer
- * \param buf Pointer to the std::uint32_t
+ * \brief Deserialize an int48_t from a padded buffer, with a single 8 bytes load whatever the alignment
+ * \param buf Pointer to the int48_t, followed by at least 2 readable bytes
  * \return The deserialized data
  */
-inline std::uint32_t GET_UINT32(const char* buf)
+inline int64_t GET_INT48_PADDED(const char* buf)
 {
-    return GET_UINT32((const std::uint8_t*)buf);
+    return load_padded<int64_t, Order::LITTLE, INT48_SIZE>(buf);
 }
 
 /**
- * \brief Deserialize an std::uint48_t from buffer.
- * \note It is return on a std::uint64_t for convenience
- * \param buf Pointer to the std::uint48_t
+ * \brief Deserialize an int24_t from a padded buffer, with a single 4 bytes load whatever the alignment
+ * \param buf Pointer to the buffer, at least 1 byte must be readable after the int24_t
+ * \param offset Offset in the buffer to access to an int24_t (in bytes)
  * \return The deserialized data
  */
-inline std::uint64_t GET_UINT48(const char* buf)
+inline int32_t GET_INT24_PADDED(const char* buf, const std::size_t offset)
 {
-    return GET_UINT48((const std::uint8_t*)buf);
+    return load_padded<int32_t, Order::LITTLE, INT24_SIZE>(buf, offset);
 }
 
 /**
- * \brief Deserialize an std::uint64_t from buffer
- * \param buf Pointer to the std::uint64_t
+ * \brief Deserialize an int48_t from a padded buffer, with a single 8 bytes load whatever the alignment
+ * \param buf Pointer to the buffer, at least 2 bytes must be readable after the int48_t
+ * \param offset Offset in the buffer to access to an int48_t (in bytes)
  * \return The deserialized data
  */
-inline std::uint64_t GET_UINT64(const char* buf)
+inline int64_t GET_INT48_PADDED(const char* buf, const std::size_t offset)
 {
-    return GET_UINT64((const std::uint8_t*)buf);
+    return load_padded<int64_t, Order::LITTLE, INT48_SIZE>(buf, offset);
 }
 
 /**
- * \brief Deserialize an int8_t from buffer
- * \param buf Pointer to the int8_t
+ * \brief Deserialize an unsigned integer of size bytes, known at runtime
+ * \param buf Pointer to the integer
+ * \param size Size of the integer, from 1 to 8 bytes
  * \return The deserialized data
  */
-inline int8_t GET_INT8(const char* buf)
+inline std::uint64_t GET_UINTN(const char* buf, const std::size_t size)
 {
-    const std::uint8_t value = GET_UINT8(buf);
-    return *(int8_t*)(&value);
+    return detail::load_var<Order::LITTLE>(reinterpret_cast<const std::uint8_t*>(buf), size);
 }
 
 /**
- * \brief Deserialize an int16_t from buffer
- * \param buf Pointer to the int16_t
+ * \brief Deserialize an unsigned integer of size bytes, known at runtime
+ * \param buf Pointer to the buffer
+ * \param offset Offset in the buffer to access to the integer (in bytes)
+ * \param size Size of the integer, from 1 to 8 bytes
  * \return The deserialized data
  */
-inline int16_t GET_INT16(const char* buf)
+inline std::uint64_t GET_UINTN(const char* buf, const std::size_t offset, const std::size_t size)
 {
-    const std::uint8_t value = GET_UINT8(buf);
-    return *(int16_t*)(&value);
+    return detail::load_var<Order::LITTLE>(reinterpret_cast<const std::uint8_t*>(buf) + offset, size);
 }
 
 /**
- * \brief Deserialize an int32_t from buffer
- * \param buf Pointer to the int32_t
+ * \brief Deserialize a signed integer of size bytes, known at runtime. The value is sign extended
+ * \param buf Pointer to the integer
+ * \param size Size of the integer, from 1 to 8 bytes
  * \return The deserialized data
  */
-inline int32_t GET_INT32(const char* buf)
+inline int64_t GET_INTN(const char* buf, const std::size_t size)
 {
-    const std::uint8_t value = GET_UINT8(buf);
-    return *(int32_t*)(&value);
+    return detail::sign_extend_var(detail::load_var<Order::LITTLE>(reinterpret_cast<const std::uint8_t*>(buf), size), size);
 }
 
 /**
- * \brief Deserialize an int48_t from buffer.
- * \note It is return on a int64_t for convenience
- * \param buf Pointer to the std::uint48_t
+ * \brief Deserialize a signed integer of size bytes, known at runtime. The value is sign extended
+ * \param buf Pointer to the buffer
+ * \param offset Offset in the buffer to access to the integer (in bytes)
+ * \param size Size of the integer, from 1 to 8 bytes
  * \return The deserialized data
  */
-inline int64_t GET_INT48(const char* buf)
+inline int64_t GET_INTN(const char* buf, const std::size_t offset, const std::size_t size)
 {
-    const std::uint8_t value = GET_UINT8(buf);
-    return *(int64_t*)(&value);
+    return detail::sign_extend_var(detail::load_var<Order::LITTLE>(reinterpret_cast<const std::uint8_t*>(buf) + offset, size), size);
 }
 
 /**
- * \brief Deserialize an int64_t from buffer
- * \param buf Pointer to the int64_t
+ * \brief Deserialize an unsigned integer of size bytes from a padded buffer, with a single 8 bytes load and no branch
+ * \param buf Pointer to the integer, followed by at least 8 - size readable bytes
+ * \param size Size of the integer, from 1 to 8 bytes
  * \return The deserialized data
  */
-inline int64_t GET_INT64(const char* buf)
+inline std::uint64_t GET_UINTN_PADDED(const char* buf, const std::size_t size)
 {
-    const std::uint8_t value = GET_UINT8(buf);
-    return *(int64_t*)(&value);
+    return detail::load_var_padded<Order::LITTLE>(reinterpret_cast<const std::uint8_t*>(buf), size);
 }
 
 /**
- * \brief Deserialize an float from buffer
- * \param buf Pointer to the float
+ * \brief Deserialize an unsigned integer of size bytes from a padded buffer, with a single 8 bytes load and no branch
+ * \param buf Pointer to the buffer, at least 8 - size bytes must be readable after the integer
+ * \param offset Offset in the buffer to access to the integer (in bytes)
+ * \param size Size of the integer, from 1 to 8 bytes
  * \return The deserialized data
  */
-inline float GET_FLOAT32(const char* buf)
+inline std::uint64_t GET_UINTN_PADDED(const char* buf, const std::size_t offset, const std::size_t size)
 {
-    const std::uint32_t value = GET_UINT32(buf);
-    return *(float*)(&value);
+    return detail::load_var_padded<Order::LITTLE>(reinterpret_cast<const std::uint8_t*>(buf) + offset, size);
 }
 
 /**
- * \brief Deserialize an double from buffer
- * \param buf Pointer to the double
+ * \brief Deserialize a signed integer of size bytes from a padded buffer, with a single 8 bytes load and no branch
+ * \param buf Pointer to the integer, followed by at least 8 - size readable bytes
+ * \param size Size of the integer, from 1 to 8 bytes
  * \return The deserialized data
  */
-inline double GET_FLOAT64(const char* buf)
+inline int64_t GET_INTN_PADDED(const char* buf, const std::size_t size)
 {
-    const std::uint64_t value = GET_UINT64(buf);
-    return *(double*)(&value);
+    return detail::sign_extend_var(detail::load_var_padded<Order::LITTLE>(reinterpret_cast<const std::uint8_t*>(buf), size), size);
 }
 
 /**
- * \brief Deserialize an std::uint8_t from buffer
- * \param buf Pointer to the buffer
- * \param offset Offset in the buffer to access to an std::uint8_t* (in bytes)
+ * \brief Deserialize a signed integer of size bytes from a padded buffer, with a single 8 bytes load and no branch
+ * \param buf Pointer to the buffer, at least 8 - size bytes must be readable after the integer
+ * \param offset Offset in the buffer to access to the integer (in bytes)
+ * \param size Size of the integer, from 1 to 8 bytes
  * \return The deserialized data
  */
-inline std::uint8_t GET_UINT8(const char* buf, const std::size_t offset)
+inline int64_t GET_INTN_PADDED(const char* buf, const std::size_t offset, const std::size_t size)
 {
-    return GET_UINT8(&buf[offset]);
+    return detail::sign_extend_var(detail::load_var_padded<Order::LITTLE>(reinterpret_cast<const std::uint8_t*>(buf) + offset, size), size);
 }
 
 /**
- * \brief Deserialize an std::uint16_t from buffer
+ * \brief Serialize the size low bytes of an unsigned integer, size being known at runtime
  * \param buf Pointer to the buffer
- * \param offset Offset in the buffer to access to an std::uint16_t* (in bytes)
- * \return The deserialized data
+ * \param val Value to serialize
+ * \param size Number of bytes to write, from 1 to 8
  */
-inline std::uint16_t GET_UINT16(const char* buf, const std::size_t offset)
+inline void SET_UINTN(char* buf, const std::uint64_t val, const std::size_t size)
 {
-    return GET_UINT16(&buf[offset]);
+    detail::store_var<Order::LITTLE>(reinterpret_cast<std::uint8_t*>(buf), val, size);
 }
 
 /**
- * \brief Deserialize an std::uint32_t from buffer
+ * \brief Serialize the size low bytes of an unsigned integer, size being known at runtime
  * \param buf Pointer to the buffer
- * \param offset Offset in the buffer to access to an std::uint32_t* (in bytes)
- * \return The deserialized data
+ * \param offset Offset in the buffer where to write the integer (in bytes)
+ * \param val Value to serialize
+ * \param size Number of bytes to write, from 1 to 8
  */
-inline std::uint32_t GET_UINT32(const char* buf, const std::size_t offset)
+inline void SET_UINTN(char* buf, const std::size_t offset, const std::uint64_t val, const std::size_t size)
 {
-    return GET_UINT32(&buf[offset]);
+    detail::store_var<Order::LITTLE>(reinterpret_cast<std::uint8_t*>(buf) + offset, val, size);
 }
 
 /**
- * \brief Deserialize an std::uint48_t from buffer
+ * \brief Serialize the size low bytes of an unsigned integer, size being known at runtime
  * \param buf Pointer to the buffer
- * \param offset Offset in the buffer to access to an std::uint48_t* (in bytes)
- * \note Store in a std::uint64_t for convenience
- * \return The deserialized data
+ * \param offset Offset in the buffer where to write the integer (in bytes)
+ * \param val Value to serialize
+ * \param size Number of bytes to write, from 1 to 8
+ * \param length Auto Increment this variable by size
  */
-inline std::uint64_t GET_UINT48(const char* buf, const std::size_t offset)
+inline void SET_UINTN(char* buf, const std::size_t offset, const std::uint64_t val, const std::size_t size, std::size_t& length)
 {
-    return GET_UINT48(&buf[offset]);
+    detail::store_var<Order::LITTLE>(reinterpret_cast<std::uint8_t*>(buf) + offset, val, size);
+    length += size;
 }
 
 /**
- * \brief Deserialize an std::uint64_t from buffer
+ * \brief Serialize the size low bytes of a signed integer, size being known at runtime
  * \param buf Pointer to the buffer
- * \param offset Offset in the buffer to access to an std::uint64_t* (in bytes)
- * \return The deserialized data
+ * \param val Value to serialize
+ * \param size Number of bytes to write, from 1 to 8
  */
-inline std::uint64_t GET_UINT64(const char* buf, const std::size_t offset)
+inline void SET_INTN(char* buf, const int64_t val, const std::size_t size)
 {
-    return GET_UINT64(&buf[offset]);
+    detail::store_var<Order::LITTLE>(reinterpret_cast<std::uint8_t*>(buf), std::uint64_t(val), size);
 }
 
 /**
- * \brief Deserialize an int8_t from buffer
+ * \brief Serialize the size low bytes of a signed integer, size being known at runtime
  * \param buf Pointer to the buffer
- * \param offset Offset in the buffer to access to an int8_t* (in bytes)
- * \return The deserialized data
+ * \param offset Offset in the buffer where to write the integer (in bytes)
+ * \param val Value to serialize
+ * \param size Number of bytes to write, from 1 to 8
  */
-inline int8_t GET_INT8(const char* buf, const std::size_t offset)
+inline void SET_INTN(char* buf, const std::size_t offset, const int64_t val, const std::size_t size)
 {
-    return GET_INT8(&buf[offset]);
+    detail::store_var<Order::LITTLE>(reinterpret_cast<std::uint8_t*>(buf) + offset, std::uint64_t(val), size);
 }
 
 /**
- * \brief Deserialize an int16_t from buffer
+ * \brief Serialize the size low bytes of a signed integer, size being known at runtime
  * \param buf Pointer to the buffer
- * \param offset Offset in the buffer to access to an int16_t* (in bytes)
- * \return The deserialized data
+ * \param offset Offset in the buffer where to write the integer (in bytes)
+ * \param val Value to serialize
+ * \param size Number of bytes to write, from 1 to 8
+ * \param length Auto Increment this variable by size
  */
-inline int16_t GET_INT16(const char* buf, const std::size_t offset)
+inline void SET_INTN(char* buf, const std::size_t offset, const int64_t val, const std::size_t size, std::size_t& length)
 {
-    return GET_INT16(&buf[offset]);
+    detail::store_var<Order::LITTLE>(reinterpret_cast<std::uint8_t*>(buf) + offset, std::uint64_t(val), size);
+    length += size;
 }
 
 /**
- * \brief Deserialize an int32_t from buffer
- * \param buf Pointer to the buffer
- * \param offset Offset in the buffer to access to an int32_t* (in bytes)
- * \return The deserialized data
+ * \brief Deserialize a fixed point value from buffer
+ * \tparam Format Fixed point format (endn::Q15, endn::Q31, endn::Fixed<int32_t, 20>, ...)
+ * \tparam T float or double
+ * \param buf Pointer to the fixed point integer
+ * \return The deserialized value, scaled by 2^-Fraction
  */
-inline int32_t GET_INT32(const char* buf, const std::size_t offset)
+template<typename Format, typename T = double>
+inline T GET_FIXED(const char* buf)
 {
-    return GET_INT32(&buf[offset]);
+    return load_fixed<Format, Order::LITTLE, T>(buf);
 }
 
 /**
- * \brief Deserialize an int48_t from buffer
+ * \brief Deserialize a fixed point value from buffer
+ * \tparam Format Fixed point format (endn::Q15, endn::Q31, endn::Fixed<int32_t, 20>, ...)
+ * \tparam T float or double
  * \param buf Pointer to the buffer
- * \param offset Offset in the buffer to access to an int48_t* (in bytes)
- * \note Store in a int64_t for convenience
- * \return The deserialized data
+ * \param offset Offset in the buffer where the fixed point integer start (in bytes)
+ * \return The deserialized value, scaled by 2^-Fraction
  */
-inline int64_t GET_INT48(const char* buf, const std::size_t offset)
+template<typename Format, typename T = double>
+inline T GET_FIXED(const char* buf, const std::size_t offset)
 {
-    return GET_INT48(&buf[offset]);
+    return load_fixed<Format, Order::LITTLE, T>(buf, offset);
 }
 
 /**
- * \brief Deserialize an int64_t from buffer
+ * \brief Serialize a value as fixed point in the buffer, saturated to the Format range (NaN give 0)
+ * \tparam Format Fixed point format (endn::Q15, endn::Q31, endn::Fixed<int32_t, 20>, ...)
  * \param buf Pointer to the buffer
- * \param offset Offset in the buffer to access to an int64_t* (in bytes)
- * \return The deserialized data
+ * \param val Value to serialize
  */
-inline int64_t GET_INT64(const char* buf, const std::size_t offset)
+template<typename Format, typename T>
+inline void SET_FIXED(char* buf, const T val)
 {
-    return GET_INT64(&buf[offset]);
+    store_fixed<Format, Order::LITTLE>(buf, 0, val);
 }
 
 /**
- * \brief Deserialize an float from buffer
+ * \brief Serialize a value as fixed point in the buffer, saturated to the Format range (NaN give 0)
+ * \tparam Format Fixed point format (endn::Q15, endn::Q31, endn::Fixed<int32_t, 20>, ...)
  * \param buf Pointer to the buffer
- * \param offset Offset in the buffer to access to an float* (in bytes)
- * \return The deserialized data
+ * \param offset Offset in the buffer where to write the fixed point integer (in bytes)
+ * \param val Value to serialize
  */
-inline float GET_FLOAT32(const char* buf, const std::size_t offset)
+template<typename Format, typename T>
+inline void SET_FIXED(char* buf, const std::size_t offset, const T val)
 {
-    return GET_FLOAT32(&buf[offset]);
+    store_fixed<Format, Order::LITTLE>(buf, offset, val);
 }
 
 /**
- * \brief Deserialize an double from buffer
+ * \brief Serialize a value as fixed point in the buffer, saturated to the Format range (NaN give 0)
+ * \tparam Format Fixed point format (endn::Q15, endn::Q31, endn::Fixed<int32_t, 20>, ...)
  * \param buf Pointer to the buffer
- * \param offset Offset in the buffer to access to an double  (in bytes)
- * \return The deserialized data
+ * \param offset Offset in the buffer where to write the fixed point integer (in bytes)
+ * \param val Value to serialize
+ * \param length Auto Increment this variable by the size of the Format integer
  */
-inline double GET_FLOAT64(const char* buf, const std::size_t offset)
+template<typename Format, typename T>
+inline void SET_FIXED(char* buf, const std::size_t offset, const T val, std::size_t& length)
 {
-    return GET_FLOAT64(&buf[offset]);
+    store_fixed<Format, Order::LITTLE>(buf, offset, val);
+    length += sizeof(typename Format::type);
 }
 
 /**
@@ -1141,7 +3432,7 @@ inline double GET_FLOAT64(const char* buf, const std::size_t offset)
  */
 inline void SET_UINT8(char* buf, const std::uint8_t val)
 {
-    SET_UINT8((std::uint8_t*)buf, *(const std::uint8_t*)&val);
+    store<std::uint8_t, Order::LITTLE>(buf, val);
 }
 
 /**
@@ -1151,7 +3442,18 @@ inline void SET_UINT8(char* buf, const std::uint8_t val)
  */
 inline void SET_UINT16(char* buf, const std::uint16_t val)
 {
-    SET_UINT16((std::uint8_t*)buf, *(const std::uint16_t*)&val);
+    store<std::uint16_t, Order::LITTLE>(buf, val);
+}
+
+/**
+ * \brief Serialize a std::uint24_t in the buffer
+ * \param buf Pointer to the buffer
+ * \param val Value to serialize
+ * \note For convenience the std::uint24 is stored into a std::uint32_t
+ */
+inline void SET_UINT24(char* buf, const std::uint32_t val)
+{
+    store<std::uint32_t, Order::LITTLE, UINT24_SIZE>(buf, val);
 }
 
 /**
@@ -1161,7 +3463,7 @@ inline void SET_UINT16(char* buf, const std::uint16_t val)
  */
 inline void SET_UINT32(char* buf, const std::uint32_t val)
 {
-    SET_UINT32((std::uint8_t*)buf, *(const std::uint32_t*)&val);
+    store<std::uint32_t, Order::LITTLE>(buf, val);
 }
 
 /**
@@ -1172,7 +3474,7 @@ inline void SET_UINT32(char* buf, const std::uint32_t val)
  */
 inline void SET_UINT48(char* buf, const std::uint64_t val)
 {
-    SET_UINT48((std::uint8_t*)buf, *(const std::uint64_t*)&val);
+    store<std::uint64_t, Order::LITTLE, UINT48_SIZE>(buf, val);
 }
 
 /**
@@ -1182,7 +3484,17 @@ inline void SET_UINT48(char* buf, const std::uint64_t val)
  */
 inline void SET_UINT64(char* buf, const std::uint64_t val)
 {
-    SET_UINT64((std::uint8_t*)buf, *(const std::uint64_t*)&val);
+    store<std::uint64_t, Order::LITTLE>(buf, val);
+}
+
+/**
+ * \brief Serialize a uint128_t in the buffer
+ * \param buf Pointer to the buffer
+ * \param val Value to serialize
+ */
+inline void SET_UINT128(char* buf, const uint128_t val)
+{
+    store_uint128<Order::LITTLE>(buf, 0, val);
 }
 
 /**
@@ -1192,7 +3504,7 @@ inline void SET_UINT64(char* buf, const std::uint64_t val)
  */
 inline void SET_INT8(char* buf, const int8_t val)
 {
-    SET_UINT8(buf, *(const std::uint8_t*)&val);
+    store<int8_t, Order::LITTLE>(buf, val);
 }
 
 /**
@@ -1202,7 +3514,18 @@ inline void SET_INT8(char* buf, const int8_t val)
  */
 inline void SET_INT16(char* buf, const int16_t val)
 {
-    SET_UINT16(buf, *(const std::uint16_t*)&val);
+    store<int16_t, Order::LITTLE>(buf, val);
+}
+
+/**
+ * \brief Serialize a int24 in the buffer
+ * \param buf Pointer to the buffer
+ * \param val Value to serialize
+ * \note For convenience the int24 is stored into a int32_t
+ */
+inline void SET_INT24(char* buf, const int32_t val)
+{
+    store<int32_t, Order::LITTLE, INT24_SIZE>(buf, val);
 }
 
 /**
@@ -1212,7 +3535,7 @@ inline void SET_INT16(char* buf, const int16_t val)
  */
 inline void SET_INT32(char* buf, const int32_t val)
 {
-    SET_UINT32(buf, *(const std::uint32_t*)&val);
+    store<int32_t, Order::LITTLE>(buf, val);
 }
 
 /**
@@ -1223,7 +3546,7 @@ inline void SET_INT32(char* buf, const int32_t val)
  */
 inline void SET_INT48(char* buf, const int64_t val)
 {
-    SET_UINT48(buf, *(const std::uint64_t*)&val);
+    store<int64_t, Order::LITTLE, INT48_SIZE>(buf, val);
 }
 
 /**
@@ -1233,7 +3556,7 @@ inline void SET_INT48(char* buf, const int64_t val)
  */
 inline void SET_INT64(char* buf, const int64_t val)
 {
-    SET_UINT64(buf, *(const std::uint64_t*)&val);
+    store<int64_t, Order::LITTLE>(buf, val);
 }
 
 /**
@@ -1243,7 +3566,27 @@ inline void SET_INT64(char* buf, const int64_t val)
  */
 inline void SET_FLOAT32(char* buf, const float val)
 {
-    SET_UINT32(buf, *(const std::uint32_t*)&val);
+    store<float, Order::LITTLE>(buf, val);
+}
+
+/**
+ * \brief Serialize a float as binary16 in the buffer
+ * \param buf Pointer to the buffer
+ * \param val Value to serialize
+ */
+inline void SET_FLOAT16(char* buf, const float val)
+{
+    store_float16<Order::LITTLE>(buf, 0, val);
+}
+
+/**
+ * \brief Serialize a float as bfloat16 in the buffer
+ * \param buf Pointer to the buffer
+ * \param val Value to serialize
+ */
+inline void SET_BFLOAT16(char* buf, const float val)
+{
+    store_bfloat16<Order::LITTLE>(buf, 0, val);
 }
 
 /**
@@ -1253,7 +3596,7 @@ inline void SET_FLOAT32(char* buf, const float val)
  */
 inline void SET_FLOAT64(char* buf, const double val)
 {
-    SET_UINT64(buf, *(const std::uint64_t*)&val);
+    store<double, Order::LITTLE>(buf, val);
 }
 
 /**
@@ -1264,7 +3607,7 @@ inline void SET_FLOAT64(char* buf, const double val)
  */
 inline void SET_UINT8(char* buf, const std::size_t offset, const std::uint8_t val)
 {
-    SET_UINT8(&buf[offset], val);
+    store<std::uint8_t, Order::LITTLE>(buf, offset, val);
 }
 
 /**
@@ -1275,7 +3618,19 @@ inline void SET_UINT8(char* buf, const std::size_t offset, const std::uint8_t va
  */
 inline void SET_UINT16(char* buf, const std::size_t offset, const std::uint16_t val)
 {
-    SET_UINT16(&buf[offset], val);
+    store<std::uint16_t, Order::LITTLE>(buf, offset, val);
+}
+
+/**
+ * \brief Serialize a std::uint24_t in the buffer
+ * \param buf Pointer to the buffer
+ * \param offset Offset in the buffer (in bytes)
+ * \param val Value to serialize
+ * \note For convenience the std::uint24 is stored into a std::uint32_t
+ */
+inline void SET_UINT24(char* buf, const std::size_t offset, const std::uint32_t val)
+{
+    store<std::uint32_t, Order::LITTLE, UINT24_SIZE>(buf, offset, val);
 }
 
 /**
@@ -1286,7 +3641,7 @@ inline void SET_UINT16(char* buf, const std::size_t offset, const std::uint16_t
  */
 inline void SET_UINT32(char* buf, const std::size_t offset, const std::uint32_t val)
 {
-    SET_UINT32(&buf[offset], val);
+    store<std::uint32_t, Order::LITTLE>(buf, offset, val);
 }
 
 /**
@@ -1298,7 +3653,7 @@ inline void SET_UINT32(char* buf, const std::size_t offset, const std::uint32_t
  */
 inline void SET_UINT48(char* buf, const std::size_t offset, const std::uint64_t val)
 {
-    SET_UINT48(&buf[offset], val);
+    store<std::uint64_t, Order::LITTLE, UINT48_SIZE>(buf, offset, val);
 }
 
 /**
@@ -1309,7 +3664,18 @@ inline void SET_UINT48(char* buf, const std::size_t offset, const std::uint64_t
  */
 inline void SET_UINT64(char* buf, const std::size_t offset, const std::uint64_t val)
 {
-    SET_UINT64(&buf[offset], val);
+    store<std::uint64_t, Order::LITTLE>(buf, offset, val);
+}
+
+/**
+ * \brief Serialize a uint128_t in the buffer
+ * \param buf Pointer to the buffer
+ * \param offset Offset in the buffer (in bytes)
+ * \param val Value to serialize
+ */
+inline void SET_UINT128(char* buf, const std::size_t offset, const uint128_t val)
+{
+    store_uint128<Order::LITTLE>(buf, offset, val);
 }
 
 /**
@@ -1320,7 +3686,7 @@ inline void SET_UINT64(char* buf, const std::size_t offset, const std::uint64_t
  */
 inline void SET_INT8(char* buf, const std::size_t offset, const int8_t val)
 {
-    SET_INT8(&buf[offset], val);
+    store<int8_t, Order::LITTLE>(buf, offset, val);
 }
 
 /**
@@ -1331,7 +3697,19 @@ inline void SET_INT8(char* buf, const std::size_t offset, const int8_t val)
  */
 inline void SET_INT16(char* buf, const std::size_t offset, const int16_t val)
 {
-    SET_INT16(&buf[offset], val);
+    store<int16_t, Order::LITTLE>(buf, offset, val);
+}
+
+/**
+ * \brief Serialize a int24_t in the buffer
+ * \param buf Pointer to the buffer
+ * \param offset Offset in the buffer (in bytes)
+ * \param val Value to serialize
+ * \note For convenience the int24 is stored into a int32_t
+ */
+inline void SET_INT24(char* buf, const std::size_t offset, const int32_t val)
+{
+    store<int32_t, Order::LITTLE, INT24_SIZE>(buf, offset, val);
 }
 
 /**
@@ -1342,7 +3720,7 @@ inline void SET_INT16(char* buf, const std::size_t offset, const int16_t val)
  */
 inline void SET_INT32(char* buf, const std::size_t offset, const int32_t val)
 {
-    SET_INT32(&buf[offset], val);
+    store<int32_t, Order::LITTLE>(buf, offset, val);
 }
 
 /**
@@ -1354,7 +3732,7 @@ inline void SET_INT32(char* buf, const std::size_t offset, const int32_t val)
  */
 inline void SET_INT48(char* buf, const std::size_t offset, const int64_t val)
 {
-    SET_INT48(&buf[offset], val);
+    store<int64_t, Order::LITTLE, INT48_SIZE>(buf, offset, val);
 }
 
 /**
@@ -1365,7 +3743,7 @@ inline void SET_INT48(char* buf, const std::size_t offset, const int64_t val)
  */
 inline void SET_INT64(char* buf, const std::size_t offset, const int64_t val)
 {
-    SET_INT64(&buf[offset], val);
+    store<int64_t, Order::LITTLE>(buf, offset, val);
 }
 
 /**
@@ -1376,7 +3754,29 @@ inline void SET_INT64(char* buf, const std::size_t offset, const int64_t val)
  */
 inline void SET_FLOAT32(char* buf, const std::size_t offset, const float val)
 {
-    SET_FLOAT32(&buf[offset], val);
+    store<float, Order::LITTLE>(buf, offset, val);
+}
+
+/**
+ * \brief Serialize a float as binary16 in the buffer
+ * \param buf Pointer to the buffer
+ * \param offset Offset in the buffer (in bytes)
+ * \param val Value to serialize
+ */
+inline void SET_FLOAT16(char* buf, const std::size_t offset, const float val)
+{
+    store_float16<Order::LITTLE>(buf, offset, val);
+}
+
+/**
+ * \brief Serialize a float as bfloat16 in the buffer
+ * \param buf Pointer to the buffer
+ * \param offset Offset in the buffer (in bytes)
+ * \param val Value to serialize
+ */
+inline void SET_BFLOAT16(char* buf, const std::size_t offset, const float val)
+{
+    store_bfloat16<Order::LITTLE>(buf, offset, val);
 }
 
 /**
@@ -1387,7 +3787,7 @@ inline void SET_FLOAT32(char* buf, const std::size_t offset, const float val)
  */
 inline void SET_FLOAT64(char* buf, const std::size_t offset, const double val)
 {
-    SET_FLOAT64(&buf[offset], val);
+    store<double, Order::LITTLE>(buf, offset, val);
 }
 
 /**
@@ -1399,7 +3799,7 @@ inline void SET_FLOAT64(char* buf, const std::size_t offset, const double val)
  */
 inline void SET_UINT8(char* buf, const std::size_t offset, const std::uint8_t val, std::size_t& length)
 {
-    SET_UINT8(buf, offset, val);
+    store<std::uint8_t, Order::LITTLE>(buf, offset, val);
     length += UINT8_SIZE;
 }
 
@@ -1412,10 +3812,24 @@ inline void SET_UINT8(char* buf, const std::size_t offset, const std::uint8_t va
  */
 inline void SET_UINT16(char* buf, const std::size_t offset, const std::uint16_t val, std::size_t& length)
 {
-    SET_UINT16(buf, offset, val);
+    store<std::uint16_t, Order::LITTLE>(buf, offset, val);
     length += UINT16_SIZE;
 }
 
+/**
+ * \brief Serialize a std::uint24_t in the buffer
+ * \param buf Pointer to the buffer
+ * \param offset Offset in the buffer (in bytes)
+ * \param length Auto Increment this variable by the size of std::uint24_t
+ * \note For convenience the std::uint24 is stored into a std::uint32_t
+ * \param val Value to serialize
+ */
+inline void SET_UINT24(char* buf, const std::size_t offset, const std::uint32_t val, std::size_t& length)
+{
+    store<std::uint32_t, Order::LITTLE, UINT24_SIZE>(buf, offset, val);
+    length += UINT24_SIZE;
+}
+
 /**
  * \brief Serialize a std::uint32_t in the buffer
  * \param buf Pointer to the buffer
@@ -1425,7 +3839,7 @@ inline void SET_UINT16(char* buf, const std::size_t offset, const std::uint16_t
  */
 inline void SET_UINT32(char* buf, const std::size_t offset, const std::uint32_t val, std::size_t& length)
 {
-    SET_UINT32(buf, offset, val);
+    store<std::uint32_t, Order::LITTLE>(buf, offset, val);
     length += UINT32_SIZE;
 }
 
@@ -1439,7 +3853,7 @@ inline void SET_UINT32(char* buf, const std::size_t offset, const std::uint32_t
  */
 inline void SET_UINT48(char* buf, const std::size_t offset, const std::uint64_t val, std::size_t& length)
 {
-    SET_UINT48(buf, offset, val);
+    store<std::uint64_t, Order::LITTLE, UINT48_SIZE>(buf, offset, val);
     length += UINT48_SIZE;
 }
 
@@ -1452,10 +3866,23 @@ inline void SET_UINT48(char* buf, const std::size_t offset, const std::uint64_t
  */
 inline void SET_UINT64(char* buf, const std::size_t offset, const std::uint64_t val, std::size_t& length)
 {
-    SET_UINT64(buf, offset, val);
+    store<std::uint64_t, Order::LITTLE>(buf, offset, val);
     length += UINT64_SIZE;
 }
 
+/**
+ * \brief Serialize a uint128_t in the buffer
+ * \param buf Pointer to the buffer
+ * \param offset Offset in the buffer (in bytes)
+ * \param length Auto Increment this variable by the size of uint128_t
+ * \param val Value to serialize
+ */
+inline void SET_UINT128(char* buf, const std::size_t offset, const uint128_t val, std::size_t& length)
+{
+    store_uint128<Order::LITTLE>(buf, offset, val);
+    length += UINT128_SIZE;
+}
+
 /**
  * \brief Serialize a int8_t in the buffer
  * \param buf Pointer to the buffer
@@ -1465,7 +3892,7 @@ inline void SET_UINT64(char* buf, const std::size_t offset, const std::uint64_t
  */
 inline void SET_INT8(char* buf, const std::size_t offset, const int8_t val, std::size_t& length)
 {
-    SET_INT8(buf, offset, val);
+    store<int8_t, Order::LITTLE>(buf, offset, val);
     length += INT8_SIZE;
 }
 
@@ -1478,10 +3905,24 @@ inline void SET_INT8(char* buf, const std::size_t offset, const int8_t val, std:
  */
 inline void SET_INT16(char* buf, const std::size_t offset, const int16_t val, std::size_t& length)
 {
-    SET_INT16(buf, offset, val);
+    store<int16_t, Order::LITTLE>(buf, offset, val);
     length += INT16_SIZE;
 }
 
+/**
+ * \brief Serialize a int24_t in the buffer
+ * \param buf Pointer to the buffer
+ * \param offset Offset in the buffer (in bytes)
+ * \param length Auto Increment this variable by the size of int24_t
+ * \note For convenience the int24 is stored into a int32_t
+ * \param val Value to serialize
+ */
+inline void SET_INT24(char* buf, const std::size_t offset, const int32_t val, std::size_t& length)
+{
+    store<int32_t, Order::LITTLE, INT24_SIZE>(buf, offset, val);
+    length += INT24_SIZE;
+}
+
 /**
  * \brief Serialize a int32_t in the buffer
  * \param buf Pointer to the buffer
@@ -1491,7 +3932,7 @@ inline void SET_INT16(char* buf, const std::size_t offset, const int16_t val, st
  */
 inline void SET_INT32(char* buf, const std::size_t offset, const int32_t val, std::size_t& length)
 {
-    SET_INT32(buf, offset, val);
+    store<int32_t, Order::LITTLE>(buf, offset, val);
     length += INT32_SIZE;
 }
 
@@ -1505,7 +3946,7 @@ inline void SET_INT32(char* buf, const std::size_t offset, const int32_t val, st
  */
 inline void SET_INT48(char* buf, const std::size_t offset, const int64_t val, std::size_t& length)
 {
-    SET_INT48(buf, offset, val);
+    store<int64_t, Order::LITTLE, INT48_SIZE>(buf, offset, val);
     length += INT48_SIZE;
 }
 
@@ -1518,7 +3959,7 @@ inline void SET_INT48(char* buf, const std::size_t offset, const int64_t val, st
  */
 inline void SET_INT64(char* buf, const std::size_t offset, const int64_t val, std::size_t& length)
 {
-    SET_INT64(buf, offset, val);
+    store<int64_t, Order::LITTLE>(buf, offset, val);
     length += INT64_SIZE;
 }
 
@@ -1531,8 +3972,34 @@ inline void SET_INT64(char* buf, const std::size_t offset, const int64_t val, st
  */
 inline void SET_FLOAT32(char* buf, const std::size_t offset, const float val, std::size_t& length)
 {
-    SET_FLOAT32(buf, offset, val);
-    length += UINT32_SIZE;
+    store<float, Order::LITTLE>(buf, offset, val);
+    length += FLOAT32_SIZE;
+}
+
+/**
+ * \brief Serialize a float as binary16 in the buffer
+ * \param buf Pointer to the buffer
+ * \param offset Offset in the buffer (in bytes)
+ * \param length Auto Increment this variable by the size of binary16 float
+ * \param val Value to serialize
+ */
+inline void SET_FLOAT16(char* buf, const std::size_t offset, const float val, std::size_t& length)
+{
+    store_float16<Order::LITTLE>(buf, offset, val);
+    length += FLOAT16_SIZE;
+}
+
+/**
+ * \brief Serialize a float as bfloat16 in the buffer
+ * \param buf Pointer to the buffer
+ * \param offset Offset in the buffer (in bytes)
+ * \param length Auto Increment this variable by the size of bfloat16
+ * \param val Value to serialize
+ */
+inline void SET_BFLOAT16(char* buf, const std::size_t offset, const float val, std::size_t& length)
+{
+    store_bfloat16<Order::LITTLE>(buf, offset, val);
+    length += BFLOAT16_SIZE;
 }
 
 /**
@@ -1544,8 +4011,8 @@ inline void SET_FLOAT32(char* buf, const std::size_t offset, const float val, st
  */
 inline void SET_FLOAT64(char* buf, const std::size_t offset, const double val, std::size_t& length)
 {
-    SET_FLOAT64(buf, offset, val);
-    length += UINT64_SIZE;
+    store<double, Order::LITTLE>(buf, offset, val);
+    length += FLOAT64_SIZE;
 }
 
 }
@@ -0,0 +1,962 @@
+/**
+ * \file Parallel.hpp
+ * \brief Multi-threaded variants of the bulk conversion functions
+ */
+#ifndef __ENDN_PARALLEL_HPP__
+#define __ENDN_PARALLEL_HPP__
+
+// ─────────────────────────────────────────────────────────────
+//                  INCLUDE
+// ─────────────────────────────────────────────────────────────
+
+// Library Headers
+#include <Endn/Endn.hpp>
+#include <Endn/Little.hpp>
+#include <Endn/Big.hpp>
+
+// C++ Headers
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/** Size of the destination (in bytes) below which the parallel functions run on the calling thread */
+#ifndef ENDN_PARALLEL_THRESHOLD
+#    define ENDN_PARALLEL_THRESHOLD (std::size_t(4) << 20)
+#endif
+
+// ─────────────────────────────────────────────────────────────
+//                  DECLARATION
+// ─────────────────────────────────────────────────────────────
+
+namespace endn {
+
+/** Size of a cache line, chunks given to each thread are aligned on it in the destination */
+static const std::size_t CACHE_LINE_SIZE = 64;
+
+/**
+ * \brief Run independent tasks, possibly on several threads.
+ * Implement it to run the parallel functions on your own thread pool.
+ */
+class Executor
+{
+public:
+    virtual ~Executor() = default;
+
+    /**
+     * \brief Number of threads that can run tasks at the same time, including the caller
+     */
+    virtual std::size_t concurrency() const = 0;
+
+    /**
+     * \brief Call task(0) ... task(tasks - 1) and return once they are all done
+     */
+    virtual void run(std::size_t tasks, const std::function<void(std::size_t)>& task) = 0;
+};
+
+/**
+ * \brief Minimal pool of worker threads. The thread calling run() executes tasks too.
+ * A task can itself call run() on the same pool: that nested batch runs inline on the task thread.
+ */
+class ThreadPool : public Executor
+{
+public:
+    /**
+     * \param workers Number of threads to start, on top of the one calling run()
+     */
+    explicit ThreadPool(const std::size_t workers)
+    {
+        for(std::size_t i = 0; i < workers; ++i)
+            _workers.emplace_back(&ThreadPool::work, this);
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    ~ThreadPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _stop = true;
+        }
+        _wake.notify_all();
+        for(auto& worker: _workers)
+            worker.join();
+    }
+
+    std::size_t concurrency() const override
+    {
+        return _workers.size() + 1;
+    }
+
+    void run(const std::size_t tasks, const std::function<void(std::size_t)>& task) override
+    {
+        // Called from a task of this pool, the batch lock is already held by the outer run()
+        if(current() == this)
+        {
+            for(std::size_t i = 0; i < tasks; ++i)
+                task(i);
+            return;
+        }
+
+        // One batch at a time, concurrent callers wait their turn
+        std::lock_guard<std::mutex> batch(_runMutex);
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _task = &task;
+            _tasks = tasks;
+            _next.store(0, std::memory_order_relaxed);
+            _active = _workers.size();
+            ++_generation;
+        }
+        _wake.notify_all();
+
+        const ThreadPool* previous = current();
+        current() = this;
+        drain();
+        current() = previous;
+
+        std::unique_lock<std::mutex> lock(_mutex);
+        _done.wait(lock,
+            [this]
+            {
+                return _active == 0;
+            });
+        _task = nullptr;
+    }
+
+private:
+    /**
+     * \brief Pool whose tasks the calling thread is executing, nullptr outside of them
+     */
+    static const ThreadPool*& current()
+    {
+        static thread_local const ThreadPool* pool = nullptr;
+        return pool;
+    }
+
+    void drain()
+    {
+        for(std::size_t i = _next.fetch_add(1); i < _tasks; i = _next.fetch_add(1))
+            (*_task)(i);
+    }
+
+    void work()
+    {
+        current() = this;
+        std::uint64_t generation = 0;
+        for(;;)
+        {
+            {
+                std::unique_lock<std::mutex> lock(_mutex);
+                _wake.wait(lock,
+                    [&]
+                    {
+                        return _stop || _generation != generation;
+                    });
+                if(_stop)
+                    return;
+                generation = _generation;
+            }
+
+            drain();
+
+            std::lock_guard<std::mutex> lock(_mutex);
+            if(--_active == 0)
+                _done.notify_one();
+        }
+    }
+
+private:
+    std::vector<std::thread> _workers;
+    std::mutex _runMutex;
+    std::mutex _mutex;
+    std::condition_variable _wake;
+    std::condition_variable _done;
+    const std::function<void(std::size_t)>* _task = nullptr;
+    std::size_t _tasks = 0;
+    std::atomic<std::size_t> _next {0};
+    std::size_t _active = 0;
+    std::uint64_t _generation = 0;
+    bool _stop = false;
+};
+
+/**
+ * \brief Executor used when none is given: a pool of up to 16 threads, started on first use.
+ */
+inline Executor& DEFAULT_EXECUTOR()
+{
+    static ThreadPool pool(
+        []
+        {
+            const std::size_t threads = std::thread::hardware_concurrency();
+            return threads == 0 ? std::size_t(0) : (threads > 16 ? 16 : threads) - 1;
+        }());
+    return pool;
+}
+
+namespace detail {
+
+/**
+ * \brief Split [0, count) in chunks and call fn(first, n) for each of them with the executor.
+ * Chunk boundaries are placed on cache lines of dest, so two threads never write the same line.
+ * The chunks decide to stream from the size of the whole destination, not from their own size.
+ * Below ENDN_PARALLEL_THRESHOLD bytes of destination, fn(0, count) is called directly.
+ * \param destSize Size of an element in dest (in bytes)
+ */
+template<typename Fn>
+inline void parallel_for(Executor* executor, const void* dest, const std::size_t count, const std::size_t destSize, const Fn& fn)
+{
+    Executor& e = executor ? *executor : DEFAULT_EXECUTOR();
+    const std::size_t bytes = count * destSize;
+    const std::size_t concurrency = e.concurrency();
+    if(bytes < ENDN_PARALLEL_THRESHOLD || concurrency < 2)
+    {
+        fn(std::size_t(0), count);
+        return;
+    }
+
+    // Elements before the first cache line boundary go in the first chunk
+    const std::size_t misalign = (CACHE_LINE_SIZE - std::uintptr_t(dest) % CACHE_LINE_SIZE) % CACHE_LINE_SIZE;
+    const std::size_t head = misalign % destSize == 0 ? misalign / destSize : 0;
+
+    // A multiple of CACHE_LINE_SIZE elements is always a multiple of CACHE_LINE_SIZE bytes
+    const std::size_t tasks = concurrency * 4;
+    std::size_t chunk = (count - head + tasks - 1) / tasks;
+    chunk = (chunk + CACHE_LINE_SIZE - 1) / CACHE_LINE_SIZE * CACHE_LINE_SIZE;
+    const std::size_t chunks = (count - head + chunk - 1) / chunk;
+
+    e.run(chunks,
+        [&](const std::size_t i)
+        {
+            const std::size_t first = i == 0 ? 0 : head + i * chunk;
+            const std::size_t last = head + (i + 1) * chunk < count ? head + (i + 1) * chunk : count;
+            const transfer_scope transfer(bytes);
+            fn(first, last - first);
+        });
+}
+
+}
+
+namespace little {
+// ─────────────────────────────────────────────────────────────
+//                  MEMCPY
+// ─────────────────────────────────────────────────────────────
+
+/**
+ * \brief Same as little::MEMCPY_UINT16, split between the threads of executor
+ * \param executor Executor to use, DEFAULT_EXECUTOR() when nullptr
+ * \note dest and src must not overlap
+ */
+inline void MEMCPY_UINT16_PARALLEL(std::uint16_t* dest, const std::uint8_t* src, const std::size_t count, Executor* executor = nullptr)
+{
+    detail::parallel_for(executor, dest, count, sizeof(std::uint16_t),
+        [=](const std::size_t first, const std::size_t n)
+        {
+            MEMCPY_UINT16(dest + first, src + first * UINT16_SIZE, n);
+        });
+}
+
+/**
+ * \brief Same as little::MEMCPY_UINT32, split between the threads of executor
+ * \param executor Executor to use, DEFAULT_EXECUTOR() when nullptr
+ * \note dest and src must not overlap
+ */
+inline void MEMCPY_UINT32_PARALLEL(std::uint32_t* dest, const std::uint8_t* src, const std::size_t count, Executor* executor = nullptr)
+{
+    detail::parallel_for(executor, dest, count, sizeof(std::uint32_t),
+        [=](const std::size_t first, const std::size_t n)
+        {
+            MEMCPY_UINT32(dest + first, src + first * UINT32_SIZE, n);
+        });
+}
+
+/**
+ * \brief Same as little::MEMCPY_UINT48, split between the threads of executor
+ * \param executor Executor to use, DEFAULT_EXECUTOR() when nullptr
+ * \note dest and src must not overlap
+ */
+inline void MEMCPY_UINT48_PARALLEL(std::uint64_t* dest, const std::uint8_t* src, const std::size_t count, Executor* executor = nullptr)
+{
+    detail::parallel_for(executor, dest, count, sizeof(std::uint64_t),
+        [=](const std::size_t first, const std::size_t n)
+        {
+            MEMCPY_UINT48(dest + first, src + first * UINT48_SIZE, n);
+        });
+}
+
+/**
+ * \brief Same as little::MEMCPY_UINT64, split between the threads of executor
+ * \param executor Executor to use, DEFAULT_EXECUTOR() when nullptr
+ * \note dest and src must not overlap
+ */
+inline void MEMCPY_UINT64_PARALLEL(std::uint64_t* dest, const std::uint8_t* src, const std::size_t count, Executor* executor = nullptr)
+{
+    detail::parallel_for(executor, dest, count, sizeof(std::uint64_t),
+        [=](const std::size_t first, const std::size_t n)
+        {
+            MEMCPY_UINT64(dest + first, src + first * UINT64_SIZE, n);
+        });
+}
+
+/**
+ * \brief Same as little::MEMCPY_INT16, split between the threads of executor
+ * \param executor Executor to use, DEFAULT_EXECUTOR() when nullptr
+ * \note dest and src must not overlap
+ */
+inline void MEMCPY_INT16_PARALLEL(int16_t* dest, const std::uint8_t* src, const std::size_t count, Executor* executor = nullptr)
+{
+    detail::parallel_for(executor, dest, count, sizeof(int16_t),
+        [=](const std::size_t first, const std::size_t n)
+        {
+            MEMCPY_INT16(dest + first, src + first * INT16_SIZE, n);
+        });
+}
+
+/**
+ * \brief Same as little::MEMCPY_INT32, split between the threads of executor
+ * \param executor Executor to use, DEFAULT_EXECUTOR() when nullptr
+ * \note dest and src must not overlap
+ */
+inline void MEMCPY_INT32_PARALLEL(int32_t* dest, const std::uint8_t* src, const std::size_t count, Executor* executor = nullptr)
+{
+    detail::parallel_for(executor, dest, count, sizeof(int32_t),
+        [=](const std::size_t first, const std::size_t n)
+        {
+            MEMCPY_INT32(dest + first, src + first * INT32_SIZE, n);
+        });
+}
+
+/**
+ * \brief Same as little::MEMCPY_INT48, split between the threads of executor
+ * \param executor Executor to use, DEFAULT_EXECUTOR() when nullptr
+ * \note dest and src must not overlap
+ */
+inline void MEMCPY_INT48_PARALLEL(int64_t* dest, const std::uint8_t* src, const std::size_t count, Executor* executor = nullptr)
+{
+    detail::parallel_for(executor, dest, count, sizeof(int64_t),
+        [=](const std::size_t first, const std::size_t n)
+        {
+            MEMCPY_INT48(dest + first, src + first * INT48_SIZE, n);
+        });
+}
+
+/**
+ * \brief Same as little::MEMCPY_INT64, split between the threads of executor
+ * \param executor Executor to use, DEFAULT_EXECUTOR() when nullptr
+ * \note dest and src must not overlap
+ */
+inline void MEMCPY_INT64_PARALLEL(int64_t* dest, const std::uint8_t* src, const std::size_t count, Executor* executor = nullptr)
+{
+    detail::parallel_for(executor, dest, count, sizeof(int64_t),
+        [=](const std::size_t first, const std::size_t n)
+        {
+            MEMCPY_INT64(dest + first, src + first * INT64_SIZE, n);
+        });
+}
+
+/**
+ * \brief Same as little::MEMCPY_FLOAT32, split between the threads of executor
+ * \param executor Executor to use, DEFAULT_EXECUTOR() when nullptr
+ * \note dest and src must not overlap
+ */
+inline void MEMCPY_FLOAT32_PARALLEL(float* dest, const std::uint8_t* src, const std::size_t count, Executor* executor = nullptr)
+{
+    detail::parallel_for(executor, dest, count, sizeof(float),
+        [=](const std::size_t first, const std::size_t n)
+        {
+            MEMCPY_FLOAT32(dest + first, src + first * FLOAT32_SIZE, n);
+        });
+}
+
+/**
+ * \brief Same as little::MEMCPY_FLOAT64, split between the threads of executor
+ * \param executor Executor to use, DEFAULT_EXECUTOR() when nullptr
+ * \note dest and src must not overlap
+ */
+inline void MEMCPY_FLOAT64_PARALLEL(double* dest, const std::uint8_t* src, const std::size_t count, Executor* executor = nullptr)
+{
+    detail::parallel_for(executor, dest, count, sizeof(double),
+        [=](const std::size_t first, const std::size_t n)
+        {
+            MEMCPY_FLOAT64(dest + first, src + first * FLOAT64_SIZE, n);
+        });
+}
+
+// ─────────────────────────────────────────────────────────────
+//                  SWAP_INPLACE
+// ─────────────────────────────────────────────────────────────
+
+/**
+ * \brief Same as little::SWAP_INPLACE_UINT16, split between the threads of executor
+ * \param executor Executor to use, DEFAULT_EXECUTOR() when nullptr
+ */
+inline void SWAP_INPLACE_UINT16_PARALLEL(std::uint16_t* buf, const std::size_t count, Executor* executor = nullptr)
+{
+    detail::parallel_for(executor, buf, count, sizeof(std::uint16_t),
+        [=](const std::size_t first, const std::size_t n)
+        {
+            SWAP_INPLACE_UINT16(buf + first, n);
+        });
+}
+
+/**
+ * \brief Same as little::SWAP_INPLACE_UINT32, split between the threads of executor
+ * \param executor Executor to use, DEFAULT_EXECUTOR() when nullptr
+ */
+inline void SWAP_INPLACE_UINT32_PARALLEL(std::uint32_t* buf, const std::size_t count, Executor* executor = nullptr)
+{
+    detail::parallel_for(executor, buf, count, sizeof(std::uint32_t),
+        [=](const std::size_t first, const std::size_t n)
+        {
+            SWAP_INPLACE_UINT32(buf + first, n);
+        });
+}
+
+/**
+ * \brief Same as little::SWAP_INPLACE_UINT64, split between the threads of executor
+ * \param executor Executor to use, DEFAULT_EXECUTOR() when nullptr
+ */
+inline void SWAP_INPLACE_UINT64_PARALLEL(std::uint64_t* buf, const std::size_t count, Executor* executor = nullptr)
+{
+    detail::parallel_for(executor, buf, count, sizeof(std::uint64_t),
+        [=](const std::size_t first, const std::size_t n)
+        {
+            SWAP_INPLACE_UINT64(buf + first, n);
+        });
+}
+
+// ─────────────────────────────────────────────────────────────
+//                  SET_ARRAY
+// ─────────────────────────────────────────────────────────────
+
+/**
+ * \brief Same as little::SET_ARRAY_UINT16, split between the threads of executor
+ * \param executor Executor to use, DEFAULT_EXECUTOR() when nullptr
+ * \return Number of bytes written
+ * \note buf and src must not overlap
+ */
+inline std::size_t SET_ARRAY_UINT16_PARALLEL(
+    std::uint8_t* buf, const std::uint16_t* src, const std::size_t count, Executor* executor = nullptr)
+{
+    detail::parallel_for(executor, buf, count, UINT16_SIZE,
+        [=](const std::size_t first, const std::size_t n)
+        {
+            SET_ARRAY_UINT16(buf + first * UINT16_SIZE, src + first, n);
+        });
+    return count * UINT16_SIZE;
+}
+
+/**
+ * \brief Same as little::SET_ARRAY_UINT32, split between the threads of executor
+ * \param executor Executor to use, DEFAULT_EXECUTOR() when nullptr
+ * \return Number of bytes written
+ * \note buf and src must not overlap
+ */
+inline std::size_t SET_ARRAY_UINT32_PARALLEL(
+    std::uint8_t* buf, const std::uint32_t* src, const std::size_t count, Executor* executor = nullptr)
+{
+    detail::parallel_for(executor, buf, count, UINT32_SIZE,
+        [=](const std::size_t first, const std::size_t n)
+        {
+            SET_ARRAY_UINT32(buf + first * UINT32_SIZE, src + first, n);
+        });
+    return count * UINT32_SIZE;
+}
+
+/**
+ * \brief Same as little::SET_ARRAY_UINT48, split between the threads of executor
+ * \param executor Executor to use, DEFAULT_EXECUTOR() when nullptr
+ * \return Number of bytes written
+ * \note buf and src must not overlap
+ */
+inline std::size_t SET_ARRAY_UINT48_PARALLEL(
+    std::uint8_t* buf, const std::uint64_t* src, const std::size_t count, Executor* executor = nullptr)
+{
+    detail::parallel_for(executor, buf, count, UINT48_SIZE,
+        [=](const std::size_t first, const std::size_t n)
+        {
+            SET_ARRAY_UINT48(buf + first * UINT48_SIZE, src + first, n);
+        });
+    return count * UINT48_SIZE;
+}
+
+/**
+ * \brief Same as little::SET_ARRAY_UINT64, split between the threads of executor
+ * \param executor Executor to use, DEFAULT_EXECUTOR() when nullptr
+ * \return Number of bytes written
+ * \note buf and src must not overlap
+ */
+inline std::size_t SET_ARRAY_UINT64_PARALLEL(
+    std::uint8_t* buf, const std::uint64_t* src, const std::size_t count, Executor* executor = nullptr)
+{
+    detail::parallel_for(executor, buf, count, UINT64_SIZE,
+        [=](const std::size_t first, const std::size_t n)
+        {
+            SET_ARRAY_UINT64(buf + first * UINT64_SIZE, src + first, n);
+        });
+    return count * UINT64_SIZE;
+}
+
+/**
+ * \brief Same as little::SET_ARRAY_INT16, split between the threads of executor
+ * \param executor Executor to use, DEFAULT_EXECUTOR() when nullptr
+ * \return Number of bytes written
+ * \note buf and src must not overlap
+ */
+inline std::size_t SET_ARRAY_INT16_PARALLEL(std::uint8_t* buf, const int16_t* src, const std::size_t count, Executor* executor = nullptr)
+{
+    detail::parallel_for(executor, buf, count, INT16_SIZE,
+        [=](const std::size_t first, const std::size_t n)
+        {
+            SET_ARRAY_INT16(buf + first * INT16_SIZE, src + first, n);
+        });
+    return count * INT16_SIZE;
+}
+
+/**
+ * \brief Same as little::SET_ARRAY_INT32, split between the threads of executor
+ * \param executor Executor to use, DEFAULT_EXECUTOR() when nullptr
+ * \return Number of bytes written
+ * \note buf and src must not overlap
+ */
+inline std::size_t SET_ARRAY_INT32_PARALLEL(std::uint8_t* buf, const int32_t* src, const std::size_t count, Executor* executor = nullptr)
+{
+    detail::parallel_for(executor, buf, count, INT32_SIZE,
+        [=](const std::size_t first, const std::size_t n)
+        {
+            SET_ARRAY_INT32(buf + first * INT32_SIZE, src + first, n);
+        });
+    return count * INT32_SIZE;
+}
+
+/**
+ * \brief Same as little::SET_ARRAY_INT48, split between the threads of executor
+ * \param executor Executor to use, DEFAULT_EXECUTOR() when nullptr
+ * \return Number of bytes written
+ * \note buf and src must not overlap
+ */
+inline std::size_t SET_ARRAY_INT48_PARALLEL(std::uint8_t* buf, const int64_t* src, const std::size_t count, Executor* executor = nullptr)
+{
+    detail::parallel_for(executor, buf, count, INT48_SIZE,
+        [=](const std::size_t first, const std::size_t n)
+        {
+            SET_ARRAY_INT48(buf + first * INT48_SIZE, src + first, n);
+        });
+    return count * INT48_SIZE;
+}
+
+/**
+ * \brief Same as little::SET_ARRAY_INT64, split between the threads of executor
+ * \param executor Executor to use, DEFAULT_EXECUTOR() when nullptr
+ * \return Number of bytes written
+ * \note buf and src must not overlap
+ */
+inline std::size_t SET_ARRAY_INT64_PARALLEL(std::uint8_t* buf, const int64_t* src, const std::size_t count, Executor* executor = nullptr)
+{
+    detail::parallel_for(executor, buf, count, INT64_SIZE,
+        [=](const std::size_t first, const std::size_t n)
+        {
+            SET_ARRAY_INT64(buf + first * INT64_SIZE, src + first, n);
+        });
+    return count * INT64_SIZE;
+}
+
+/**
+ * \brief Same as little::SET_ARRAY_FLOAT32, split between the threads of executor
+ * \param executor Executor to use, DEFAULT_EXECUTOR() when nullptr
+ * \return Number of bytes written
+ * \note buf and src must not overlap
+ */
+inline std::size_t SET_ARRAY_FLOAT32_PARALLEL(std::uint8_t* buf, const float* src, const std::size_t count, Executor* executor = nullptr)
+{
+    detail::parallel_for(executor, buf, count, FLOAT32_SIZE,
+        [=](const std::size_t first, const std::size_t n)
+        {
+            SET_ARRAY_FLOAT32(buf + first * FLOAT32_SIZE, src + first, n);
+        });
+    return count * FLOAT32_SIZE;
+}
+
+/**
+ * \brief Same as little::SET_ARRAY_FLOAT64, split between the threads of executor
+ * \param executor Executor to use, DEFAULT_EXECUTOR() when nullptr
+ * \return Number of bytes written
+ * \note buf and src must not overlap
+ */
+inline std::size_t SET_ARRAY_FLOAT64_PARALLEL(std::uint8_t* buf, const double* src, const std::size_t count, Executor* executor = nullptr)
+{
+    detail::parallel_for(executor, buf, count, FLOAT64_SIZE,
+        [=](const std::size_t first, const std::size_t n)
+        {
+            SET_ARRAY_FLOAT64(buf + first * FLOAT64_SIZE, src + first, n);
+        });
+    return count * FLOAT64_SIZE;
+}
+
+}
+
+namespace big {
+// ─────────────────────────────────────────────────────────────
+//                  MEMCPY
+// ─────────────────────────────────────────────────────────────
+
+/**
+ * \brief Same as big::MEMCPY_UINT16, split between the threads of executor
+ * \param executor Executor to use, DEFAULT_EXECUTOR() when nullptr
+ * \note dest and src must not overlap
+ */
+inline void MEMCPY_UINT16_PARALLEL(std::uint16_t* dest, const std::uint8_t* src, const std::size_t count, Executor* executor = nullptr)
+{
+    detail::parallel_for(executor, dest, count, sizeof(std::uint16_t),
+        [=](const std::size_t first, const std::size_t n)
+        {
+            MEMCPY_UINT16(dest + first, src + first * UINT16_SIZE, n);
+        });
+}
+
+/**
+ * \brief Same as big::MEMCPY_UINT32, split between the threads of executor
+ * \param executor Executor to use, DEFAULT_EXECUTOR() when nullptr
+ * \note dest and src must not overlap
+ */
+inline void MEMCPY_UINT32_PARALLEL(std::uint32_t* dest, const std::uint8_t* src, const std::size_t count, Executor* executor = nullptr)
+{
+    detail::parallel_for(executor, dest, count, sizeof(std::uint32_t),
+        [=](const std::size_t first, const std::size_t n)
+        {
+            MEMCPY_UINT32(dest + first, src + first * UINT32_SIZE, n);
+        });
+}
+
+/**
+ * \brief Same as big::MEMCPY_UINT48, split between the threads of executor
+ * \param executor Executor to use, DEFAULT_EXECUTOR() when nullptr
+ * \note dest and src must not overlap
+ */
+inline void MEMCPY_UINT48_PARALLEL(std::uint64_t* dest, const std::uint8_t* src, const std::size_t count, Executor* executor = nullptr)
+{
+    detail::parallel_for(executor, dest, count, sizeof(std::uint64_t),
+        [=](const std::size_t first, const std::size_t n)
+        {
+            MEMCPY_UINT48(dest + first, src + first * UINT48_SIZE, n);
+        });
+}
+
+/**
+ * \brief Same as big::MEMCPY_UINT64, split between the threads of executor
+ * \param executor Executor to use, DEFAULT_EXECUTOR() when nullptr
+ * \note dest and src must not overlap
+ */
+inline void MEMCPY_UINT64_PARALLEL(std::uint64_t* dest, const std::uint8_t* src, const std::size_t count, Executor* executor = nullptr)
+{
+    detail::parallel_for(executor, dest, count, sizeof(std::uint64_t),
+        [=](const std::size_t first, const std::size_t n)
+        {
+            MEMCPY_UINT64(dest + first, src + first * UINT64_SIZE, n);
+        });
+}
+
+/**
+ * \brief Same as big::MEMCPY_INT16, split between the threads of executor
+ * \param executor Executor to use, DEFAULT_EXECUTOR() when nullptr
+ * \note dest and src must not overlap
+ */
+inline void MEMCPY_INT16_PARALLEL(int16_t* dest, const std::uint8_t* src, const std::size_t count, Executor* executor = nullptr)
+{
+    detail::parallel_for(executor, dest, count, sizeof(int16_t),
+        [=](const std::size_t first, const std::size_t n)
+        {
+            MEMCPY_INT16(dest + first, src + first * INT16_SIZE, n);
+        });
+}
+
+/**
+ * \brief Same as big::MEMCPY_INT32, split between the threads of executor
+ * \param executor Executor to use, DEFAULT_EXECUTOR() when nullptr
+ * \note dest and src must not overlap
+ */
+inline void MEMCPY_INT32_PARALLEL(int32_t* dest, const std::uint8_t* src, const std::size_t count, Executor* executor = nullptr)
+{
+    detail::parallel_for(executor, dest, count, sizeof(int32_t),
+        [=](const std::size_t first, const std::size_t n)
+        {
+            MEMCPY_INT32(dest + first, src + first * INT32_SIZE, n);
+        });
+}
+
+/**
+ * \brief Same as big::MEMCPY_INT48, split between the threads of executor
+ * \param executor Executor to use, DEFAULT_EXECUTOR() when nullptr
+ * \note dest and src must not overlap
+ */
+inline void MEMCPY_INT48_PARALLEL(int64_t* dest, const std::uint8_t* src, const std::size_t count, Executor* executor = nullptr)
+{
+    detail::parallel_for(executor, dest, count, sizeof(int64_t),
+        [=](const std::size_t first, const std::size_t n)
+        {
+            MEMCPY_INT48(dest + first, src + first * INT48_SIZE, n);
+        });
+}
+
+/**
+ * \brief Same as big::MEMCPY_INT64, split between the threads of executor
+ * \param executor Executor to use, DEFAULT_EXECUTOR() when nullptr
+ * \note dest and src must not overlap
+ */
+inline void MEMCPY_INT64_PARALLEL(int64_t* dest, const std::uint8_t* src, const std::size_t count, Executor* executor = nullptr)
+{
+    detail::parallel_for(executor, dest, count, sizeof(int64_t),
+        [=](const std::size_t first, const std::size_t n)
+        {
+            MEMCPY_INT64(dest + first, src + first * INT64_SIZE, n);
+        });
+}
+
+/**
+ * \brief Same as big::MEMCPY_FLOAT32, split between the threads of executor
+ * \param executor Executor to use, DEFAULT_EXECUTOR() when nullptr
+ * \note dest and src must not overlap
+ */
+inline void MEMCPY_FLOAT32_PARALLEL(float* dest, const std::uint8_t* src, const std::size_t count, Executor* executor = nullptr)
+{
+    detail::parallel_for(executor, dest, count, sizeof(float),
+        [=](const std::size_t first, const std::size_t n)
+        {
+            MEMCPY_FLOAT32(dest + first, src + first * FLOAT32_SIZE, n);
+        });
+}
+
+/**
+ * \brief Same as big::MEMCPY_FLOAT64, split between the threads of executor
+ * \param executor Executor to use, DEFAULT_EXECUTOR() when nullptr
+ * \note dest and src must not overlap
+ */
+inline void MEMCPY_FLOAT64_PARALLEL(double* dest, const std::uint8_t* src, const std::size_t count, Executor* executor = nullptr)
+{
+    detail::parallel_for(executor, dest, count, sizeof(double),
+        [=](const std::size_t first, const std::size_t n)
+        {
+            MEMCPY_FLOAT64(dest + first, src + first * FLOAT64_SIZE, n);
+        });
+}
+
+// ─────────────────────────────────────────────────────────────
+//                  SWAP_INPLACE
+// ─────────────────────────────────────────────────────────────
+
+/**
+ * \brief Same as big::SWAP_INPLACE_UINT16, split between the threads of executor
+ * \param executor Executor to use, DEFAULT_EXECUTOR() when nullptr
+ */
+inline void SWAP_INPLACE_UINT16_PARALLEL(std::uint16_t* buf, const std::size_t count, Executor* executor = nullptr)
+{
+    detail::parallel_for(executor, buf, count, sizeof(std::uint16_t),
+        [=](const std::size_t first, const std::size_t n)
+        {
+            SWAP_INPLACE_UINT16(buf + first, n);
+        });
+}
+
+/**
+ * \brief Same as big::SWAP_INPLACE_UINT32, split between the threads of executor
+ * \param executor Executor to use, DEFAULT_EXECUTOR() when nullptr
+ */
+inline void SWAP_INPLACE_UINT32_PARALLEL(std::uint32_t* buf, const std::size_t count, Executor* executor = nullptr)
+{
+    detail::parallel_for(executor, buf, count, sizeof(std::uint32_t),
+        [=](const std::size_t first, const std::size_t n)
+        {
+            SWAP_INPLACE_UINT32(buf + first, n);
+        });
+}
+
+/**
+ * \brief Same as big::SWAP_INPLACE_UINT64, split between the threads of executor
+ * \param executor Executor to use, DEFAULT_EXECUTOR() when nullptr
+ */
+inline void SWAP_INPLACE_UINT64_PARALLEL(std::uint64_t* buf, const std::size_t count, Executor* executor = nullptr)
+{
+    detail::parallel_for(executor, buf, count, sizeof(std::uint64_t),
+        [=](const std::size_t first, const std::size_t n)
+        {
+            SWAP_INPLACE_UINT64(buf + first, n);
+        });
+}
+
+// ─────────────────────────────────────────────────────────────
+//                  SET_ARRAY
+// ─────────────────────────────────────────────────────────────
+
+/**
+ * \brief Same as big::SET_ARRAY_UINT16, split between the threads of executor
+ * \param executor Executor to use, DEFAULT_EXECUTOR() when nullptr
+ * \return Number of bytes written
+ * \note buf and src must not overlap
+ */
+inline std::size_t SET_ARRAY_UINT16_PARALLEL(
+    std::uint8_t* buf, const std::uint16_t* src, const std::size_t count, Executor* executor = nullptr)
+{
+    detail::parallel_for(executor, buf, count, UINT16_SIZE,
+        [=](const std::size_t first, const std::size_t n)
+        {
+            SET_ARRAY_UINT16(buf + first * UINT16_SIZE, src + first, n);
+        });
+    return count * UINT16_SIZE;
+}
+
+/**
+ * \brief Same as big::SET_ARRAY_UINT32, split between the threads of executor
+ * \param executor Executor to use, DEFAULT_EXECUTOR() when nullptr
+ * \return Number of bytes written
+ * \note buf and src must not overlap
+ */
+inline std::size_t SET_ARRAY_UINT32_PARALLEL(
+    std::uint8_t* buf, const std::uint32_t* src, const std::size_t count, Executor* executor = nullptr)
+{
+    detail::parallel_for(executor, buf, count, UINT32_SIZE,
+        [=](const std::size_t first, const std::size_t n)
+        {
+            SET_ARRAY_UINT32(buf + first * UINT32_SIZE, src + first, n);
+        });
+    return count * UINT32_SIZE;
+}
+
+/**
+ * \brief Same as big::SET_ARRAY_UINT48, split between the threads of executor
+ * \param executor Executor to use, DEFAULT_EXECUTOR() when nullptr
+ * \return Number of bytes written
+ * \note buf and src must not overlap
+ */
+inline std::size_t SET_ARRAY_UINT48_PARALLEL(
+    std::uint8_t* buf, const std::uint64_t* src, const std::size_t count, Executor* executor = nullptr)
+{
+    detail::parallel_for(executor, buf, count, UINT48_SIZE,
+        [=](const std::size_t first, const std::size_t n)
+        {
+            SET_ARRAY_UINT48(buf + first * UINT48_SIZE, src + first, n);
+        });
+    return count * UINT48_SIZE;
+}
+
+/**
+ * \brief Same as big::SET_ARRAY_UINT64, split between the threads of executor
+ * \param executor Executor to use, DEFAULT_EXECUTOR() when nullptr
+ * \return Number of bytes written
+ * \note buf and src must not overlap
+ */
+inline std::size_t SET_ARRAY_UINT64_PARALLEL(
+    std::uint8_t* buf, const std::uint64_t* src, const std::size_t count, Executor* executor = nullptr)
+{
+    detail::parallel_for(executor, buf, count, UINT64_SIZE,
+        [=](const std::size_t first, const std::size_t n)
+        {
+            SET_ARRAY_UINT64(buf + first * UINT64_SIZE, src + first, n);
+        });
+    return count * UINT64_SIZE;
+}
+
+/**
+ * \brief Same as big::SET_ARRAY_INT16, split between the threads of executor
+ * \param executor Executor to use, DEFAULT_EXECUTOR() when nullptr
+ * \return Number of bytes written
+ * \note buf and src must not overlap
+ */
+inline std::size_t SET_ARRAY_INT16_PARALLEL(std::uint8_t* buf, const int16_t* src, const std::size_t count, Executor* executor = nullptr)
+{
+    detail::parallel_for(executor, buf, count, INT16_SIZE,
+        [=](const std::size_t first, const std::size_t n)
+        {
+            SET_ARRAY_INT16(buf + first * INT16_SIZE, src + first, n);
+        });
+    return count * INT16_SIZE;
+}
+
+/**
+ * \brief Same as big::SET_ARRAY_INT32, split between the threads of executor
+ * \param executor Executor to use, DEFAULT_EXECUTOR() when nullptr
+ * \return Number of bytes written
+ * \note buf and src must not overlap
+ */
+inline std::size_t SET_ARRAY_INT32_PARALLEL(std::uint8_t* buf, const int32_t* src, const std::size_t count, Executor* executor = nullptr)
+{
+    detail::parallel_for(executor, buf, count, INT32_SIZE,
+        [=](const std::size_t first, const std::size_t n)
+        {
+            SET_ARRAY_INT32(buf + first * INT32_SIZE, src + first, n);
+        });
+    return count * INT32_SIZE;
+}
+
+/**
+ * \brief Same as big::SET_ARRAY_INT48, split between the threads of executor
+ * \param executor Executor to use, DEFAULT_EXECUTOR() when nullptr
+ * \return Number of bytes written
+ * \note buf and src must not overlap
+ */
+inline std::size_t SET_ARRAY_INT48_PARALLEL(std::uint8_t* buf, const int64_t* src, const std::size_t count, Executor* executor = nullptr)
+{
+    detail::parallel_for(executor, buf, count, INT48_SIZE,
+        [=](const std::size_t first, const std::size_t n)
+        {
+            SET_ARRAY_INT48(buf + first * INT48_SIZE, src + first, n);
+        });
+    return count * INT48_SIZE;
+}
+
+/**
+ * \brief Same as big::SET_ARRAY_INT64, split between the threads of executor
+ * \param executor Executor to use, DEFAULT_EXECUTOR() when nullptr
+ * \return Number of bytes written
+ * \note buf and src must not overlap
+ */
+inline std::size_t SET_ARRAY_INT64_PARALLEL(std::uint8_t* buf, const int64_t* src, const std::size_t count, Executor* executor = nullptr)
+{
+    detail::parallel_for(executor, buf, count, INT64_SIZE,
+        [=](const std::size_t first, const std::size_t n)
+        {
+            SET_ARRAY_INT64(buf + first * INT64_SIZE, src + first, n);
+        });
+    return count * INT64_SIZE;
+}
+
+/**
+ * \brief Same as big::SET_ARRAY_FLOAT32, split between the threads of executor
+ * \param executor Executor to use, DEFAULT_EXECUTOR() when nullptr
+ * \return Number of bytes written
+ * \note buf and src must not overlap
+ */
+inline std::size_t SET_ARRAY_FLOAT32_PARALLEL(std::uint8_t* buf, const float* src, const std::size_t count, Executor* executor = nullptr)
+{
+    detail::parallel_for(executor, buf, count, FLOAT32_SIZE,
+        [=](const std::size_t first, const std::size_t n)
+        {
+            SET_ARRAY_FLOAT32(buf + first * FLOAT32_SIZE, src + first, n);
+        });
+    return count * FLOAT32_SIZE;
+}
+
+/**
+ * \brief Same as big::SET_ARRAY_FLOAT64, split between the threads of executor
+ * \param executor Executor to use, DEFAULT_EXECUTOR() when nullptr
+ * \return Number of bytes written
+ * \note buf and src must not overlap
+ */
+inline std::size_t SET_ARRAY_FLOAT64_PARALLEL(std::uint8_t* buf, const double* src, const std::size_t count, Executor* executor = nullptr)
+{
+    detail::parallel_for(executor, buf, count, FLOAT64_SIZE,
+        [=](const std::size_t first, const std::size_t n)
+        {
+            SET_ARRAY_FLOAT64(buf + first * FLOAT64_SIZE, src + first, n);
+        });
+    return count * FLOAT64_SIZE;
+}
+
+}
+}
+
+#endif
@@ -0,0 +1,279 @@
+/**
+ * \file Reader.hpp
+ * \brief Cursor over a serialized buffer, bounds checked once per window instead of once per field
+ */
+#ifndef __ENDN_READER_HPP__
+#define __ENDN_READER_HPP__
+
+// ─────────────────────────────────────────────────────────────
+//                  INCLUDE
+// ─────────────────────────────────────────────────────────────
+
+// Library Headers
+#include <Endn/Endn.hpp>
+#include <Endn/Core.hpp>
+
+// C++ Headers
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+
+// ─────────────────────────────────────────────────────────────
+//                  DECLARATION
+// ─────────────────────────────────────────────────────────────
+
+namespace endn {
+
+/**
+ * \brief Read typed fields of the given order one after the other from (data, size).
+ *
+ * ensure(n) is the only bounds check: once it returned true, the next n bytes can be read with the
+ * unchecked uint8() ... float64() without any test. read(value) check and read a single field.
+ * A failed check mark the reader as failed, so a parser can test ok() once at the end.
+ *
+ * \code
+ * endn::big::Reader reader(buffer, size);
+ * if(!reader.ensure(12))
+ *     return false;
+ * const std::uint32_t id = reader.uint32();
+ * const double value = reader.float64();
+ * \endcode
+ */
+template<Order order>
+class Reader
+{
+public:
+    Reader(const void* data, const std::size_t size) :
+        _begin(static_cast<const std::uint8_t*>(data)), _cursor(_begin), _end(_begin + size)
+    {
+    }
+
+    // ───── Bounds
+
+    /**
+     * \brief Check that n bytes can be read from the cursor. Mark the reader as failed otherwise.
+     * \return true when the next n bytes can be read unchecked
+     */
+    bool ensure(const std::size_t n)
+    {
+        if(n <= remaining())
+            return true;
+        _failed = true;
+        return false;
+    }
+
+    /**
+     * \brief false once a check (ensure, read, seek) failed
+     */
+    bool ok() const
+    {
+        return !_failed;
+    }
+
+    /**
+     * \brief Number of bytes read since the beginning of the buffer
+     */
+    std::size_t position() const
+    {
+        return std::size_t(_cursor - _begin);
+    }
+
+    /**
+     * \brief Number of bytes left after the cursor
+     */
+    std::size_t remaining() const
+    {
+        return std::size_t(_end - _cursor);
+    }
+
+    /**
+     * \brief Pointer to the next byte to read
+     */
+    const std::uint8_t* current() const
+    {
+        return _cursor;
+    }
+
+    /**
+     * \brief Move the cursor to position, checked against the buffer size
+     */
+    bool seek(const std::size_t position)
+    {
+        if(position > std::size_t(_end - _begin))
+        {
+            _failed = true;
+            return false;
+        }
+        _cursor = _begin + position;
+        return true;
+    }
+
+    // ───── Unchecked reads, inside a window opened by ensure
+
+    void skip(const std::size_t n)
+    {
+        _cursor += n;
+    }
+
+    void bytes(void* dest, const std::size_t n)
+    {
+        std::memcpy(dest, _cursor, n);
+        _cursor += n;
+    }
+
+    std::uint8_t uint8()
+    {
+        return get<std::uint8_t>();
+    }
+
+    int8_t int8()
+    {
+        return get<int8_t>();
+    }
+
+    std::uint16_t uint16()
+    {
+        return get<std::uint16_t>();
+    }
+
+    int16_t int16()
+    {
+        return get<int16_t>();
+    }
+
+    std::uint32_t uint24()
+    {
+        return get<std::uint32_t, UINT24_SIZE>();
+    }
+
+    int32_t int24()
+    {
+        return get<int32_t, INT24_SIZE>();
+    }
+
+    std::uint32_t uint32()
+    {
+        return get<std::uint32_t>();
+    }
+
+    int32_t int32()
+    {
+        return get<int32_t>();
+    }
+
+    std::uint64_t uint48()
+    {
+        return get<std::uint64_t, UINT48_SIZE>();
+    }
+
+    int64_t int48()
+    {
+        return get<int64_t, INT48_SIZE>();
+    }
+
+    std::uint64_t uint64()
+    {
+        return get<std::uint64_t>();
+    }
+
+    int64_t int64()
+    {
+        return get<int64_t>();
+    }
+
+    uint128_t uint128()
+    {
+        const uint128_t value = load_uint128<order>(_cursor);
+        _cursor += UINT128_SIZE;
+        return value;
+    }
+
+    float float16()
+    {
+        const float value = load_float16<order>(_cursor);
+        _cursor += FLOAT16_SIZE;
+        return value;
+    }
+
+    float bfloat16()
+    {
+        const float value = load_bfloat16<order>(_cursor);
+        _cursor += BFLOAT16_SIZE;
+        return value;
+    }
+
+    float float32()
+    {
+        return get<float>();
+    }
+
+    double float64()
+    {
+        return get<double>();
+    }
+
+    template<typename Format, typename T = double>
+    T fixed()
+    {
+        const T value = load_fixed<Format, order, T>(_cursor);
+        _cursor += sizeof(typename Format::type);
+        return value;
+    }
+
+    /**
+     * \brief Read a T of Size bytes (Size < sizeof(T) for the 24 and 48 bits integers)
+     */
+    template<typename T, std::size_t Size = sizeof(T)>
+    T get()
+    {
+        const T value = load<T, order, Size>(_cursor);
+        _cursor += Size;
+        return value;
+    }
+
+    // ───── Checked reads
+
+    /**
+     * \brief Read a single field, when it fit in the buffer
+     * \return false, and value untouched, when there isn't sizeof(T) bytes left
+     */
+    template<typename T>
+    bool read(T& value)
+    {
+        static_assert(std::is_arithmetic<T>::value && !std::is_same<T, bool>::value, "read(value) is for integers and floating points");
+        if(!ensure(sizeof(T)))
+            return false;
+        value = get<T>();
+        return true;
+    }
+
+    /**
+     * \brief Copy n bytes, when they fit in the buffer
+     */
+    bool read(void* dest, const std::size_t n)
+    {
+        if(!ensure(n))
+            return false;
+        bytes(dest, n);
+        return true;
+    }
+
+private:
+    const std::uint8_t* _begin;
+    const std::uint8_t* _cursor;
+    const std::uint8_t* _end;
+    bool _failed = false;
+};
+
+namespace little {
+typedef endn::Reader<Order::LITTLE> Reader;
+}
+
+namespace big {
+typedef endn::Reader<Order::BIG> Reader;
+}
+
+}
+
+#endif
@@ -0,0 +1,2399 @@
+/**
+ * \file Simd.hpp
+ * \brief Bulk byte swap kernels with runtime cpu dispatch
+ */
+#ifndef __ENDN_SIMD_HPP__
+#define __ENDN_SIMD_HPP__
+
+// ─────────────────────────────────────────────────────────────
+//                  INCLUDE
+// ─────────────────────────────────────────────────────────────
+
+// Library Headers
+#include <Endn/Endn.hpp>
+#include <Endn/Core.hpp>
+
+// C++ Headers
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+
+#if defined(ENDN_ENABLE_SIMD) && (defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86))
+#    define ENDN_SIMD_X86
+#    ifdef _MSC_VER
+#        include <intrin.h>
+#        include <immintrin.h>
+#        define ENDN_TARGET_SSSE3
+#        define ENDN_TARGET_AVX2
+#        define ENDN_TARGET_F16C
+#    else
+#        include <cpuid.h>
+#        include <immintrin.h>
+#        define ENDN_TARGET_SSSE3 __attribute__((target("ssse3")))
+#        define ENDN_TARGET_AVX2 __attribute__((target("avx2")))
+#        define ENDN_TARGET_F16C __attribute__((target("avx2,f16c")))
+#    endif
+#endif
+
+// Hint the cpu to load a cache line that will soon be read. Never fault, even on an invalid address
+#if defined(__GNUC__)
+#    define ENDN_PREFETCH(ptr) __builtin_prefetch(ptr)
+#elif defined(ENDN_SIMD_X86)
+#    define ENDN_PREFETCH(ptr) _mm_prefetch(reinterpret_cast<const char*>(ptr), _MM_HINT_T0)
+#else
+#    define ENDN_PREFETCH(ptr) ((void)(ptr))
+#endif
+
+// GCC and Clang vector extensions, lowered to the native shuffle of every target (NEON, VSX, z/Vector, SSE, ...)
+#if defined(ENDN_ENABLE_SIMD) && defined(__GNUC__)
+#    define ENDN_SIMD_VECTOR
+#endif
+
+/** Default size (in bytes) from which bulk conversions write with non-temporal stores */
+#ifndef ENDN_STREAMING_THRESHOLD
+#    define ENDN_STREAMING_THRESHOLD (std::size_t(32) << 20)
+#endif
+
+// ─────────────────────────────────────────────────────────────
+//                  DECLARATION
+// ─────────────────────────────────────────────────────────────
+
+namespace endn {
+
+/**
+ * \brief Instruction set used by the bulk functions (MEMCPY_*, ...)
+ * The best one supported by the cpu is selected on first use.
+ */
+enum class Simd : std::uint8_t
+{
+    SCALAR,
+    SSSE3,
+    AVX2,
+    /** Portable vector extensions of GCC and Clang */
+    VECTOR,
+};
+
+/** Streaming threshold that make every bulk conversion use non-temporal stores */
+static const std::size_t STREAMING_ALWAYS = 0;
+
+/** Streaming threshold that disable non-temporal stores */
+static const std::size_t STREAMING_NEVER = std::size_t(-1);
+
+namespace detail {
+
+// ─────────────────────────────────────────────────────────────
+//                  SCALAR
+// ─────────────────────────────────────────────────────────────
+
+/**
+ * \brief Reverse the bytes of count elements of type T from src into dest.
+ * Neither pointer need to be aligned. dest == src is allowed.
+ */
+template<typename T>
+inline void swap_scalar(void* dest, const void* src, const std::size_t count)
+{
+    std::uint8_t* d = static_cast<std::uint8_t*>(dest);
+    const std::uint8_t* s = static_cast<const std::uint8_t*>(src);
+    const std::uint8_t* const end = s + count * sizeof(T);
+    for(; s != end; s += sizeof(T), d += sizeof(T))
+    {
+        T value;
+        std::memcpy(&value, s, sizeof(T));
+        value = byteswap(value);
+        std::memcpy(d, &value, sizeof(T));
+    }
+}
+
+/**
+ * \brief Number of leading elements to process before dest reach an alignment of 'alignment' bytes.
+ * Return 0 if dest isn't even aligned on sizeof(T), because in that case it will never be.
+ */
+template<typename T>
+inline std::size_t head_count(const void* dest, const std::size_t count, const std::size_t alignment)
+{
+    const std::uintptr_t ptr = std::uintptr_t(dest);
+    if(ptr % sizeof(T) != 0)
+        return 0;
+    const std::size_t head = ((alignment - ptr % alignment) % alignment) / sizeof(T);
+    return head < count ? head : count;
+}
+
+/**
+ * \brief pshufb control that reverse each element of sizeof(T) bytes, repeated for 32 bytes.
+ */
+template<typename T>
+inline const std::uint8_t* swap_shuffle()
+{
+    static const std::uint8_t shuffle16[32] = {
+        1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14, 1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14};
+    static const std::uint8_t shuffle32[32] = {
+        3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12, 3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12};
+    static const std::uint8_t shuffle64[32] = {
+        7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8};
+    static const std::uint8_t shuffle128[32] = {
+        15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0};
+    return sizeof(T) == 2 ? shuffle16 : sizeof(T) == 4 ? shuffle32 : sizeof(T) == 8 ? shuffle64 : shuffle128;
+}
+
+/**
+ * \brief Unpack count 6 bytes integers of the given order from src into host std::uint64_t.
+ * When Signed is true the 48th bit is extended in the 16 msb.
+ */
+template<Order order, bool Signed>
+inline void unpack48_scalar(std::uint64_t* dest, const std::uint8_t* src, const std::size_t count)
+{
+    for(std::size_t i = 0; i < count; ++i, src += UINT48_SIZE)
+    {
+        std::uint64_t value;
+        if(order == Order::LITTLE)
+            value = (std::uint64_t(src[5]) << 40) | (std::uint64_t(src[4]) << 32) | (std::uint64_t(src[3]) << 24)
+                    | (std::uint64_t(src[2]) << 16) | (std::uint64_t(src[1]) << 8) | std::uint64_t(src[0]);
+        else
+            value = (std::uint64_t(src[0]) << 40) | (std::uint64_t(src[1]) << 32) | (std::uint64_t(src[2]) << 24)
+                    | (std::uint64_t(src[3]) << 16) | (std::uint64_t(src[4]) << 8) | std::uint64_t(src[5]);
+        dest[i] = Signed ? bit_cast<std::uint64_t>(sign_extend48(value)) : value;
+    }
+}
+
+/**
+ * \brief Pack count host std::uint64_t into 6 bytes integers of the given order. The upper 16 bits are dropped.
+ */
+template<Order order>
+inline void pack48_scalar(std::uint8_t* dest, const std::uint64_t* src, const std::size_t count)
+{
+    for(std::size_t i = 0; i < count; ++i, dest += UINT48_SIZE)
+    {
+        for(std::size_t b = 0; b < UINT48_SIZE; ++b)
+        {
+            const std::size_t shift = 8 * (order == Order::LITTLE ? b : UINT48_SIZE - 1 - b);
+            dest[b] = std::uint8_t(src[i] >> shift);
+        }
+    }
+}
+
+/**
+ * \brief Unpack count 3 bytes integers of the given order from src into host std::uint32_t.
+ * When Signed is true the 24th bit is extended in the 8 msb.
+ */
+template<Order order, bool Signed>
+inline void unpack24_scalar(std::uint32_t* dest, const std::uint8_t* src, const std::size_t count)
+{
+    for(std::size_t i = 0; i < count; ++i, src += UINT24_SIZE)
+    {
+        const std::uint32_t value = order == Order::LITTLE
+                                        ? (std::uint32_t(src[2]) << 16) | (std::uint32_t(src[1]) << 8) | std::uint32_t(src[0])
+                                        : (std::uint32_t(src[0]) << 16) | (std::uint32_t(src[1]) << 8) | std::uint32_t(src[2]);
+        dest[i] = Signed ? (value ^ 0x800000) - 0x800000 : value;
+    }
+}
+
+/**
+ * \brief Pack count host std::uint32_t into 3 bytes integers of the given order. The upper 8 bits are dropped.
+ */
+template<Order order>
+inline void pack24_scalar(std::uint8_t* dest, const std::uint32_t* src, const std::size_t count)
+{
+    for(std::size_t i = 0; i < count; ++i, dest += UINT24_SIZE)
+    {
+        for(std::size_t b = 0; b < UINT24_SIZE; ++b)
+        {
+            const std::size_t shift = 8 * (order == Order::LITTLE ? b : UINT24_SIZE - 1 - b);
+            dest[b] = std::uint8_t(src[i] >> shift);
+        }
+    }
+}
+
+/**
+ * \brief Widen count IEEE binary16 of the given order from src into float.
+ */
+template<Order order>
+inline void unpack_float16_scalar(float* dest, const std::uint8_t* src, const std::size_t count)
+{
+    for(std::size_t i = 0; i < count; ++i)
+        dest[i] = half_to_float(load<std::uint16_t, order>(src, i * FLOAT16_SIZE));
+}
+
+/**
+ * \brief Narrow count float into IEEE binary16 of the given order, rounding to nearest even.
+ */
+template<Order order>
+inline void pack_float16_scalar(std::uint8_t* dest, const float* src, const std::size_t count)
+{
+    for(std::size_t i = 0; i < count; ++i)
+        store<std::uint16_t, order>(dest, i * FLOAT16_SIZE, float_to_half(src[i]));
+}
+
+/**
+ * \brief Widen count bfloat16 of the given order from src into float.
+ */
+template<Order order>
+inline void unpack_bfloat16_scalar(float* dest, const std::uint8_t* src, const std::size_t count)
+{
+    for(std::size_t i = 0; i < count; ++i)
+        dest[i] = bfloat16_to_float(load<std::uint16_t, order>(src, i * BFLOAT16_SIZE));
+}
+
+/**
+ * \brief Narrow count float into bfloat16 of the given order, rounding to nearest even.
+ */
+template<Order order>
+inline void pack_bfloat16_scalar(std::uint8_t* dest, const float* src, const std::size_t count)
+{
+    for(std::size_t i = 0; i < count; ++i)
+        store<std::uint16_t, order>(dest, i * BFLOAT16_SIZE, float_to_bfloat16(src[i]));
+}
+
+/**
+ * \brief Convert count fixed point Format of the given order from src into float or double.
+ */
+template<typename Format, Order order, typename T>
+inline void unpack_fixed_scalar(T* dest, const std::uint8_t* src, const std::size_t count)
+{
+    for(std::size_t i = 0; i < count; ++i)
+        dest[i] = load_fixed<Format, order, T>(src, i * sizeof(typename Format::type));
+}
+
+/**
+ * \brief Convert count float or double into fixed point Format of the given order, with saturation.
+ */
+template<typename Format, Order order, typename T>
+inline void pack_fixed_scalar(std::uint8_t* dest, const T* src, const std::size_t count)
+{
+    for(std::size_t i = 0; i < count; ++i)
+        store_fixed<Format, order>(dest, i * sizeof(typename Format::type), src[i]);
+}
+
+/**
+ * \brief Kind of conversion between a serialized type and a host type, to select a fused kernel.
+ * Extensions can't overflow, narrowing saturate unsigned integers and round double to float.
+ */
+enum Conversion
+{
+    CONVERT_SCALAR,
+    CONVERT_ZERO_EXTEND,
+    CONVERT_SIGN_EXTEND,
+    CONVERT_FLOAT_EXTEND,
+    CONVERT_UINT_NARROW,
+    CONVERT_FLOAT_NARROW,
+};
+
+template<int Kind, std::size_t From, std::size_t To>
+struct convert_tag
+{
+};
+
+/**
+ * \brief Select the Conversion from From to To. Only the widths that have a kernel get something else than CONVERT_SCALAR.
+ */
+template<typename From, typename To>
+struct conversion
+{
+    static const bool integers = std::is_integral<From>::value && sizeof(From) >= 2 && sizeof(From) <= 8 && sizeof(To) <= 8;
+    static const bool floats = std::is_floating_point<From>::value && sizeof(From) + sizeof(To) == 12;
+    static const bool extend = sizeof(To) > sizeof(From) && sizeof(To) >= 4;
+    static const bool narrow =
+        sizeof(From) == 2 * sizeof(To) && sizeof(To) >= 2 && !std::is_signed<From>::value && !std::is_signed<To>::value;
+
+    static const int kind = floats                                   ? (extend ? CONVERT_FLOAT_EXTEND : CONVERT_FLOAT_NARROW)
+                          : !integers                                ? CONVERT_SCALAR
+                          : extend && !std::is_signed<From>::value ? CONVERT_ZERO_EXTEND
+                          : extend && std::is_signed<To>::value    ? CONVERT_SIGN_EXTEND
+                          : narrow                                 ? CONVERT_UINT_NARROW
+                                                                   : CONVERT_SCALAR;
+
+    typedef convert_tag<kind, sizeof(From), sizeof(To)> tag;
+};
+
+/**
+ * \brief Integer val converted to To, clamped to the To range. saturated is incremented when val doesn't fit.
+ */
+template<typename To, typename From>
+inline To saturate_convert(const From val, std::size_t& saturated, std::true_type)
+{
+    if(std::is_signed<From>::value && int64_t(val) < 0)
+    {
+        const int64_t low = std::is_signed<To>::value ? int64_t(std::numeric_limits<To>::min()) : 0;
+        if(int64_t(val) >= low)
+            return To(val);
+        ++saturated;
+        return To(low);
+    }
+    if(std::uint64_t(val) <= std::uint64_t(std::numeric_limits<To>::max()))
+        return To(val);
+    ++saturated;
+    return std::numeric_limits<To>::max();
+}
+
+/**
+ * \brief Floating point val converted to To, rounded to nearest. A finite val too large for To become an infinity
+ * and increment saturated.
+ */
+template<typename To, typename From>
+inline To saturate_convert(const From val, std::size_t& saturated, std::false_type)
+{
+    const To result = To(val);
+    if(std::isinf(result) && !std::isinf(val))
+        ++saturated;
+    return result;
+}
+
+/**
+ * \brief Convert count Wire of the given order from src into host T.
+ * \return Number of values that were saturated
+ */
+template<typename Wire, Order order, typename T>
+inline std::size_t unpack_convert_scalar(T* dest, const std::uint8_t* src, const std::size_t count)
+{
+    std::size_t saturated = 0;
+    for(std::size_t i = 0; i < count; ++i)
+        dest[i] = saturate_convert<T>(load<Wire, order>(src, i * sizeof(Wire)), saturated, std::is_integral<T>());
+    return saturated;
+}
+
+/**
+ * \brief Convert count host T from src into Wire of the given order.
+ * \return Number of values that were saturated
+ */
+template<typename Wire, Order order, typename T>
+inline std::size_t pack_convert_scalar(std::uint8_t* dest, const T* src, const std::size_t count)
+{
+    std::size_t saturated = 0;
+    for(const T* end = src + count; src != end; ++src, dest += sizeof(Wire))
+        store<Wire, order>(dest, 0, saturate_convert<Wire>(*src, saturated, std::is_integral<Wire>()));
+    return saturated;
+}
+
+/**
+ * \brief pshufb controls for the 48 bits codec, repeated for 32 bytes.
+ * Unpack spread two packed 6 bytes integers into two 8 bytes lanes, pack does the opposite.
+ * The signed unpack copy the most significant byte in the 2 upper bytes, see sign_fix48.
+ */
+template<Order order, bool Signed>
+inline const std::uint8_t* unpack48_shuffle()
+{
+    static const std::uint8_t little[32] = {0, 1, 2, 3, 4, 5, 0x80, 0x80, 6, 7, 8, 9, 10, 11, 0x80, 0x80,
+        0, 1, 2, 3, 4, 5, 0x80, 0x80, 6, 7, 8, 9, 10, 11, 0x80, 0x80};
+    static const std::uint8_t big[32] = {5, 4, 3, 2, 1, 0, 0x80, 0x80, 11, 10, 9, 8, 7, 6, 0x80, 0x80,
+        5, 4, 3, 2, 1, 0, 0x80, 0x80, 11, 10, 9, 8, 7, 6, 0x80, 0x80};
+    static const std::uint8_t littleSigned[32] = {
+        0, 1, 2, 3, 4, 5, 5, 5, 6, 7, 8, 9, 10, 11, 11, 11, 0, 1, 2, 3, 4, 5, 5, 5, 6, 7, 8, 9, 10, 11, 11, 11};
+    static const std::uint8_t bigSigned[32] = {
+        5, 4, 3, 2, 1, 0, 0, 0, 11, 10, 9, 8, 7, 6, 6, 6, 5, 4, 3, 2, 1, 0, 0, 0, 11, 10, 9, 8, 7, 6, 6, 6};
+    if(Signed)
+        return order == Order::LITTLE ? littleSigned : bigSigned;
+    return order == Order::LITTLE ? little : big;
+}
+
+template<Order order>
+inline const std::uint8_t* pack48_shuffle()
+{
+    static const std::uint8_t little[32] = {0, 1, 2, 3, 4, 5, 8, 9, 10, 11, 12, 13, 0x80, 0x80, 0x80, 0x80,
+        0, 1, 2, 3, 4, 5, 8, 9, 10, 11, 12, 13, 0x80, 0x80, 0x80, 0x80};
+    static const std::uint8_t big[32] = {5, 4, 3, 2, 1, 0, 13, 12, 11, 10, 9, 8, 0x80, 0x80, 0x80, 0x80,
+        5, 4, 3, 2, 1, 0, 13, 12, 11, 10, 9, 8, 0x80, 0x80, 0x80, 0x80};
+    return order == Order::LITTLE ? little : big;
+}
+
+/**
+ * \brief pshufb controls for the 24 bits codec, repeated for 32 bytes.
+ * Unpack spread four packed 3 bytes integers in the 3 upper bytes of four 4 bytes lanes,
+ * so a logical or arithmetic shift right by 8 zero or sign extend them. Pack does the opposite.
+ */
+template<Order order>
+inline const std::uint8_t* unpack24_shuffle()
+{
+    static const std::uint8_t little[32] = {0x80, 0, 1, 2, 0x80, 3, 4, 5, 0x80, 6, 7, 8, 0x80, 9, 10, 11,
+        0x80, 0, 1, 2, 0x80, 3, 4, 5, 0x80, 6, 7, 8, 0x80, 9, 10, 11};
+    static const std::uint8_t big[32] = {0x80, 2, 1, 0, 0x80, 5, 4, 3, 0x80, 8, 7, 6, 0x80, 11, 10, 9,
+        0x80, 2, 1, 0, 0x80, 5, 4, 3, 0x80, 8, 7, 6, 0x80, 11, 10, 9};
+    return order == Order::LITTLE ? little : big;
+}
+
+template<Order order>
+inline const std::uint8_t* pack24_shuffle()
+{
+    static const std::uint8_t little[32] = {0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, 0x80, 0x80, 0x80, 0x80,
+        0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, 0x80, 0x80, 0x80, 0x80};
+    static const std::uint8_t big[32] = {2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, 0x80, 0x80, 0x80, 0x80,
+        2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, 0x80, 0x80, 0x80, 0x80};
+    return order == Order::LITTLE ? little : big;
+}
+
+/**
+ * \brief pshufb controls for the bfloat16 codec, repeated for 32 bytes.
+ * Unpack move four bfloat16 in the 2 upper bytes of four 4 bytes lanes and zero the lower ones.
+ * Pack keep the 2 upper bytes of each lane, in the first 8 bytes.
+ */
+template<Order order>
+inline const std::uint8_t* unpack_bfloat16_shuffle()
+{
+    static const std::uint8_t little[32] = {0x80, 0x80, 0, 1, 0x80, 0x80, 2, 3, 0x80, 0x80, 4, 5, 0x80, 0x80, 6, 7,
+        0x80, 0x80, 0, 1, 0x80, 0x80, 2, 3, 0x80, 0x80, 4, 5, 0x80, 0x80, 6, 7};
+    static const std::uint8_t big[32] = {0x80, 0x80, 1, 0, 0x80, 0x80, 3, 2, 0x80, 0x80, 5, 4, 0x80, 0x80, 7, 6,
+        0x80, 0x80, 1, 0, 0x80, 0x80, 3, 2, 0x80, 0x80, 5, 4, 0x80, 0x80, 7, 6};
+    return order == Order::LITTLE ? little : big;
+}
+
+template<Order order>
+inline const std::uint8_t* pack_bfloat16_shuffle()
+{
+    static const std::uint8_t little[32] = {2, 3, 6, 7, 10, 11, 14, 15, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+        2, 3, 6, 7, 10, 11, 14, 15, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80};
+    static const std::uint8_t big[32] = {3, 2, 7, 6, 11, 10, 15, 14, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+        3, 2, 7, 6, 11, 10, 15, 14, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80};
+    return order == Order::LITTLE ? little : big;
+}
+
+/**
+ * \brief Copy count fields of type T spaced by stride bytes from src into the contiguous dest, in host order.
+ */
+template<typename T, Order order>
+inline void extract_scalar(T* dest, const std::uint8_t* src, const std::size_t stride, const std::size_t count)
+{
+    for(std::size_t i = 0; i < count; ++i, src += stride)
+    {
+        T value;
+        std::memcpy(&value, src, sizeof(T));
+        dest[i] = order == HOST_ORDER ? value : byteswap(value);
+    }
+}
+
+/**
+ * \brief Number of fields a gather prefetch ahead of the one it load, so the cache misses of random offsets overlap.
+ */
+static const std::size_t GATHER_PREFETCH_DISTANCE = 16;
+
+/**
+ * \brief Copy count fields of type T at src + offsets[i] into the contiguous dest, in host order.
+ */
+template<typename T, Order order>
+inline void gather_scalar(T* dest, const std::uint8_t* src, const std::size_t* offsets, const std::size_t count)
+{
+    for(std::size_t i = 0; i < count; ++i)
+    {
+        if(i + GATHER_PREFETCH_DISTANCE < count)
+            ENDN_PREFETCH(src + offsets[i + GATHER_PREFETCH_DISTANCE]);
+        T value;
+        std::memcpy(&value, src + offsets[i], sizeof(T));
+        dest[i] = order == HOST_ORDER ? value : byteswap(value);
+    }
+}
+
+// ─────────────────────────────────────────────────────────────
+//                  VECTOR
+// ─────────────────────────────────────────────────────────────
+
+#ifdef ENDN_SIMD_VECTOR
+
+typedef std::uint8_t vector16 __attribute__((vector_size(16)));
+typedef std::uint64_t vector2u __attribute__((vector_size(16)));
+typedef std::int64_t vector2i __attribute__((vector_size(16)));
+typedef std::uint32_t vector4u __attribute__((vector_size(16)));
+typedef std::int32_t vector4i __attribute__((vector_size(16)));
+
+// Pick bytes of a (0..15) and b (16..31), indices must be constant
+#    ifdef __clang__
+#        define ENDN_SHUFFLE_BYTES(a, b, ...) __builtin_shufflevector(a, b, __VA_ARGS__)
+#    else
+#        define ENDN_SHUFFLE_BYTES(a, b, ...) __builtin_shuffle(a, b, vector16 {__VA_ARGS__})
+#    endif
+
+/**
+ * \brief Reverse each element of sizeof(T) bytes in a 16 bytes vector.
+ */
+template<typename T>
+struct vector_swap;
+
+template<>
+struct vector_swap<std::uint8_t>
+{
+    static vector16 apply(const vector16 v)
+    {
+        return v;
+    }
+};
+
+template<>
+struct vector_swap<std::uint16_t>
+{
+    static vector16 apply(const vector16 v)
+    {
+        return ENDN_SHUFFLE_BYTES(v, v, 1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+    }
+};
+
+template<>
+struct vector_swap<std::uint32_t>
+{
+    static vector16 apply(const vector16 v)
+    {
+        return ENDN_SHUFFLE_BYTES(v, v, 3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+    }
+};
+
+template<>
+struct vector_swap<std::uint64_t>
+{
+    static vector16 apply(const vector16 v)
+    {
+        return ENDN_SHUFFLE_BYTES(v, v, 7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8);
+    }
+};
+
+template<>
+struct vector_swap<uint128_t>
+{
+    static vector16 apply(const vector16 v)
+    {
+        return ENDN_SHUFFLE_BYTES(v, v, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+    }
+};
+
+/**
+ * \brief Significance of the byte at position j of a host 64 bits lane. It is also the position of the byte of significance j.
+ */
+constexpr int host_significance(const int j)
+{
+#    ifdef ENDN_IS_BIG_ENDIAN
+    return 7 - j % 8;
+#    else
+    return j % 8;
+#    endif
+}
+
+/**
+ * \brief Byte of 2 packed 6 bytes integers to put at position j of the 2 host std::uint64_t, 16 to put a zero.
+ */
+constexpr int unpack48_index(const Order order, const int j)
+{
+    return host_significance(j) >= 6 ? 16
+                                     : j / 8 * 6 + (order == Order::LITTLE ? host_significance(j) : 5 - host_significance(j));
+}
+
+/**
+ * \brief Byte of 2 host std::uint64_t to put at position j of the 2 packed 6 bytes integers, 16 to put a zero.
+ */
+constexpr int pack48_index(const Order order, const int j)
+{
+    return j >= 12 ? 16 : j / 6 * 8 + host_significance(order == Order::LITTLE ? j % 6 : 5 - j % 6);
+}
+
+/**
+ * \brief Significance of the byte at position j of a host 32 bits lane. It is also the position of the byte of significance j.
+ */
+constexpr int host_significance32(const int j)
+{
+#    ifdef ENDN_IS_BIG_ENDIAN
+    return 3 - j % 4;
+#    else
+    return j % 4;
+#    endif
+}
+
+/**
+ * \brief Byte of 4 packed 3 bytes integers to put at position j of the 4 host std::uint32_t, shifted left by 8.
+ * 16 to put a zero.
+ */
+constexpr int unpack24_index(const Order order, const int j)
+{
+    return host_significance32(j) == 0
+               ? 16
+               : j / 4 * 3 + (order == Order::LITTLE ? host_significance32(j) - 1 : 3 - host_significance32(j));
+}
+
+/**
+ * \brief Byte of 4 host std::uint32_t to put at position j of the 4 packed 3 bytes integers, 16 to put a zero.
+ */
+constexpr int pack24_index(const Order order, const int j)
+{
+    return j >= 12 ? 16 : j / 3 * 4 + host_significance32(order == Order::LITTLE ? j % 3 : 2 - j % 3);
+}
+
+/**
+ * \brief Byte of 4 packed bfloat16 to put at position j of 4 host floats, 16 to put a zero.
+ */
+constexpr int unpack_bfloat16_index(const Order order, const int j)
+{
+    return host_significance32(j) < 2
+               ? 16
+               : j / 4 * 2 + (order == Order::LITTLE ? host_significance32(j) - 2 : 3 - host_significance32(j));
+}
+
+/**
+ * \brief Byte of 4 host floats to put at position j of the 4 packed bfloat16, 16 to put a zero.
+ */
+constexpr int pack_bfloat16_index(const Order order, const int j)
+{
+    return j >= 8 ? 16 : j / 2 * 4 + host_significance32(order == Order::LITTLE ? 2 + j % 2 : 3 - j % 2);
+}
+
+#    define ENDN_INDICES_16(f, order)                                                                                               \
+        f(order, 0), f(order, 1), f(order, 2), f(order, 3), f(order, 4), f(order, 5), f(order, 6), f(order, 7), f(order, 8),      \
+            f(order, 9), f(order, 10), f(order, 11), f(order, 12), f(order, 13), f(order, 14), f(order, 15)
+
+template<Order order, bool Signed>
+inline void unpack48_vector(std::uint64_t* dest, const std::uint8_t* src, const std::size_t count)
+{
+    const vector16 zero = {};
+    const std::size_t bytes = count * UINT48_SIZE;
+    std::size_t i = 0;
+    // Each 16 bytes load hold 2 integers, the 4 last bytes are read again by the next load
+    for(; i * UINT48_SIZE + 16 <= bytes; i += 2)
+    {
+        vector16 a;
+        std::memcpy(&a, src + i * UINT48_SIZE, 16);
+        const vector16 b = ENDN_SHUFFLE_BYTES(a, zero, ENDN_INDICES_16(unpack48_index, order));
+        vector2u value = vector2u(b);
+        if(Signed)
+            value = vector2u(vector2i(value << 16) >> 16);
+        std::memcpy(dest + i, &value, 16);
+    }
+    unpack48_scalar<order, Signed>(dest + i, src + i * UINT48_SIZE, count - i);
+}
+
+template<Order order>
+inline void pack48_vector(std::uint8_t* dest, const std::uint64_t* src, const std::size_t count)
+{
+    const vector16 zero = {};
+    const std::size_t bytes = count * UINT48_SIZE;
+    std::size_t i = 0;
+    // Each 16 bytes store write 2 integers followed by 4 zero bytes, overwritten by the next store
+    for(; i * UINT48_SIZE + 16 <= bytes; i += 2)
+    {
+        vector16 a;
+        std::memcpy(&a, src + i, 16);
+        const vector16 b = ENDN_SHUFFLE_BYTES(a, zero, ENDN_INDICES_16(pack48_index, order));
+        std::memcpy(dest + i * UINT48_SIZE, &b, 16);
+    }
+    pack48_scalar<order>(dest + i * UINT48_SIZE, src + i, count - i);
+}
+
+template<Order order, bool Signed>
+inline void unpack24_vector(std::uint32_t* dest, const std::uint8_t* src, const std::size_t count)
+{
+    const vector16 zero = {};
+    const std::size_t bytes = count * UINT24_SIZE;
+    std::size_t i = 0;
+    // Each 16 bytes load hold 4 integers, the 4 last bytes are read again by the next load
+    for(; i * UINT24_SIZE + 16 <= bytes; i += 4)
+    {
+        vector16 a;
+        std::memcpy(&a, src + i * UINT24_SIZE, 16);
+        const vector16 b = ENDN_SHUFFLE_BYTES(a, zero, ENDN_INDICES_16(unpack24_index, order));
+        const vector4u value = Signed ? vector4u(vector4i(b) >> 8) : vector4u(b) >> 8;
+        std::memcpy(dest + i, &value, 16);
+    }
+    unpack24_scalar<order, Signed>(dest + i, src + i * UINT24_SIZE, count - i);
+}
+
+template<Order order>
+inline void pack24_vector(std::uint8_t* dest, const std::uint32_t* src, const std::size_t count)
+{
+    const vector16 zero = {};
+    const std::size_t bytes = count * UINT24_SIZE;
+    std::size_t i = 0;
+    // Each 16 bytes store write 4 integers followed by 4 zero bytes, overwritten by the next store
+    for(; i * UINT24_SIZE + 16 <= bytes; i += 4)
+    {
+        vector16 a;
+        std::memcpy(&a, src + i, 16);
+        const vector16 b = ENDN_SHUFFLE_BYTES(a, zero, ENDN_INDICES_16(pack24_index, order));
+        std::memcpy(dest + i * UINT24_SIZE, &b, 16);
+    }
+    pack24_scalar<order>(dest + i * UINT24_SIZE, src + i, count - i);
+}
+
+template<Order order>
+inline void unpack_bfloat16_vector(float* dest, const std::uint8_t* src, const std::size_t count)
+{
+    const vector16 zero = {};
+    std::size_t i = 0;
+    for(; i + 4 <= count; i += 4)
+    {
+        vector16 a = {};
+        std::memcpy(&a, src + i * BFLOAT16_SIZE, 8);
+        const vector16 b = ENDN_SHUFFLE_BYTES(a, zero, ENDN_INDICES_16(unpack_bfloat16_index, order));
+        std::memcpy(dest + i, &b, 16);
+    }
+    unpack_bfloat16_scalar<order>(dest + i, src + i * BFLOAT16_SIZE, count - i);
+}
+
+template<Order order>
+inline void pack_bfloat16_vector(std::uint8_t* dest, const float* src, const std::size_t count)
+{
+    const vector16 zero = {};
+    std::size_t i = 0;
+    for(; i + 4 <= count; i += 4)
+    {
+        vector4u a;
+        std::memcpy(&a, src + i, 16);
+        // Round to nearest even in the 16 msb, NaN are kept quiet instead
+        const vector4u rounded = a + 0x7FFF + ((a >> 16) & 1);
+        const vector4u nan = vector4u((a & 0x7FFFFFFF) > 0x7F800000);
+        const vector4u b = (nan & (a | 0x400000)) | (~nan & rounded);
+        const vector16 c = ENDN_SHUFFLE_BYTES(vector16(b), zero, ENDN_INDICES_16(pack_bfloat16_index, order));
+        std::memcpy(dest + i * BFLOAT16_SIZE, &c, 8);
+    }
+    pack_bfloat16_scalar<order>(dest + i * BFLOAT16_SIZE, src + i, count - i);
+}
+
+#    undef ENDN_INDICES_16
+#    undef ENDN_SHUFFLE_BYTES
+
+template<typename T>
+inline void swap_vector(void* dest, const void* src, const std::size_t count)
+{
+    std::uint8_t* d = static_cast<std::uint8_t*>(dest);
+    const std::uint8_t* s = static_cast<const std::uint8_t*>(src);
+
+    // memcpy to and from the vectors compile to unaligned loads and stores
+    std::size_t i = 0;
+    const std::size_t bytes = count * sizeof(T);
+    for(; i + 64 <= bytes; i += 64)
+    {
+        vector16 v[4];
+        std::memcpy(v, s + i, 64);
+        v[0] = vector_swap<T>::apply(v[0]);
+        v[1] = vector_swap<T>::apply(v[1]);
+        v[2] = vector_swap<T>::apply(v[2]);
+        v[3] = vector_swap<T>::apply(v[3]);
+        std::memcpy(d + i, v, 64);
+    }
+    for(; i + 16 <= bytes; i += 16)
+    {
+        vector16 v;
+        std::memcpy(&v, s + i, 16);
+        v = vector_swap<T>::apply(v);
+        std::memcpy(d + i, &v, 16);
+    }
+    swap_scalar<T>(d + i, s + i, (bytes - i) / sizeof(T));
+}
+
+#endif
+
+// ─────────────────────────────────────────────────────────────
+//                  X86
+// ─────────────────────────────────────────────────────────────
+
+#ifdef ENDN_SIMD_X86
+
+enum : unsigned
+{
+    CPU_SSSE3 = 1 << 0,
+    CPU_AVX2 = 1 << 1,
+    CPU_F16C = 1 << 2,
+};
+
+/**
+ * \brief Query cpuid (and xgetbv for the ymm state) to know which instruction sets are usable.
+ */
+inline unsigned cpu_features()
+{
+    unsigned features = 0;
+    unsigned regs[4] = {0, 0, 0, 0};
+    unsigned maxLeaf = 0;
+#    ifdef _MSC_VER
+    int info[4];
+    __cpuid(info, 0);
+    maxLeaf = unsigned(info[0]);
+    __cpuid(info, 1);
+    for(int i = 0; i < 4; ++i)
+        regs[i] = unsigned(info[i]);
+#    else
+    maxLeaf = __get_cpuid_max(0, nullptr);
+    if(maxLeaf >= 1)
+        __get_cpuid(1, &regs[0], &regs[1], &regs[2], &regs[3]);
+#    endif
+    if(regs[2] & (1u << 9))
+        features |= CPU_SSSE3;
+
+    // AVX2 need the os to save ymm registers (OSXSAVE + XCR0 bit 1 and 2)
+    const bool osxsave = (regs[2] & (1u << 27)) && (regs[2] & (1u << 28));
+    if(!osxsave || maxLeaf < 7)
+        return features;
+#    ifdef _MSC_VER
+    const unsigned long long xcr0 = _xgetbv(0);
+    __cpuidex(info, 7, 0);
+    const unsigned ebx7 = unsigned(info[1]);
+#    else
+    unsigned xcr0Low = 0;
+    unsigned xcr0High = 0;
+    __asm__ volatile("xgetbv" : "=a"(xcr0Low), "=d"(xcr0High) : "c"(0));
+    const unsigned long long xcr0 = xcr0Low;
+    unsigned eax7 = 0, ebx7 = 0, ecx7 = 0, edx7 = 0;
+    __cpuid_count(7, 0, eax7, ebx7, ecx7, edx7);
+#    endif
+    if((xcr0 & 0x6) == 0x6 && (ebx7 & (1u << 5)))
+        features |= CPU_AVX2;
+    if((xcr0 & 0x6) == 0x6 && (regs[2] & (1u << 29)))
+        features |= CPU_F16C;
+    return features;
+}
+
+inline unsigned cached_cpu_features()
+{
+    static const unsigned features = cpu_features();
+    return features;
+}
+
+/**
+ * \brief Store a vector to dest, with a non-temporal store when Stream is true (dest must then be aligned).
+ */
+template<bool Stream>
+ENDN_TARGET_SSSE3 inline void store_ssse3(std::uint8_t* dest, const __m128i value)
+{
+    if(Stream)
+        _mm_stream_si128(reinterpret_cast<__m128i*>(dest), value);
+    else
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dest), value);
+}
+
+template<typename T, bool Stream>
+ENDN_TARGET_SSSE3 inline void swap_ssse3(void* dest, const void* src, const std::size_t count)
+{
+    std::uint8_t* d = static_cast<std::uint8_t*>(dest);
+    const std::uint8_t* s = static_cast<const std::uint8_t*>(src);
+    const __m128i shuffle = _mm_loadu_si128(reinterpret_cast<const __m128i*>(swap_shuffle<T>()));
+
+    const std::size_t head = head_count<T>(d, count, 16);
+    swap_scalar<T>(d, s, head);
+
+    std::size_t i = head * sizeof(T);
+    const std::size_t bytes = count * sizeof(T);
+    for(; i + 64 <= bytes; i += 64)
+    {
+        const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i));
+        const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i + 16));
+        const __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i + 32));
+        const __m128i e = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i + 48));
+        store_ssse3<Stream>(d + i, _mm_shuffle_epi8(a, shuffle));
+        store_ssse3<Stream>(d + i + 16, _mm_shuffle_epi8(b, shuffle));
+        store_ssse3<Stream>(d + i + 32, _mm_shuffle_epi8(c, shuffle));
+        store_ssse3<Stream>(d + i + 48, _mm_shuffle_epi8(e, shuffle));
+    }
+    for(; i + 16 <= bytes; i += 16)
+    {
+        const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i));
+        store_ssse3<Stream>(d + i, _mm_shuffle_epi8(a, shuffle));
+    }
+    swap_scalar<T>(d + i, s + i, (bytes - i) / sizeof(T));
+    if(Stream)
+        _mm_sfence();
+}
+
+/**
+ * \brief Store a vector to dest, with a non-temporal store when Stream is true (dest must then be aligned).
+ */
+template<bool Stream>
+ENDN_TARGET_AVX2 inline void store_avx2(std::uint8_t* dest, const __m256i value)
+{
+    if(Stream)
+        _mm256_stream_si256(reinterpret_cast<__m256i*>(dest), value);
+    else
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dest), value);
+}
+
+template<typename T, bool Stream>
+ENDN_TARGET_AVX2 inline void swap_avx2(void* dest, const void* src, const std::size_t count)
+{
+    std::uint8_t* d = static_cast<std::uint8_t*>(dest);
+    const std::uint8_t* s = static_cast<const std::uint8_t*>(src);
+    const __m256i shuffle = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(swap_shuffle<T>()));
+
+    const std::size_t head = head_count<T>(d, count, 32);
+    swap_scalar<T>(d, s, head);
+
+    std::size_t i = head * sizeof(T);
+    const std::size_t bytes = count * sizeof(T);
+    for(; i + 128 <= bytes; i += 128)
+    {
+        const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s + i));
+        const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s + i + 32));
+        const __m256i c = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s + i + 64));
+        const __m256i e = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s + i + 96));
+        store_avx2<Stream>(d + i, _mm256_shuffle_epi8(a, shuffle));
+        store_avx2<Stream>(d + i + 32, _mm256_shuffle_epi8(b, shuffle));
+        store_avx2<Stream>(d + i + 64, _mm256_shuffle_epi8(c, shuffle));
+        store_avx2<Stream>(d + i + 96, _mm256_shuffle_epi8(e, shuffle));
+    }
+    for(; i + 32 <= bytes; i += 32)
+    {
+        const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s + i));
+        store_avx2<Stream>(d + i, _mm256_shuffle_epi8(a, shuffle));
+    }
+    swap_scalar<T>(d + i, s + i, (bytes - i) / sizeof(T));
+    if(Stream)
+        _mm_sfence();
+}
+
+/**
+ * \brief memcpy with non-temporal stores, for when the order already match.
+ */
+ENDN_TARGET_SSSE3 inline void copy_stream(void* dest, const void* src, const std::size_t bytes)
+{
+    std::uint8_t* d = static_cast<std::uint8_t*>(dest);
+    const std::uint8_t* s = static_cast<const std::uint8_t*>(src);
+
+    std::size_t i = (16 - std::uintptr_t(d) % 16) % 16;
+    i = i < bytes ? i : bytes;
+    std::memcpy(d, s, i);
+    for(; i + 64 <= bytes; i += 64)
+    {
+        const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i));
+        const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i + 16));
+        const __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i + 32));
+        const __m128i e = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i + 48));
+        _mm_stream_si128(reinterpret_cast<__m128i*>(d + i), a);
+        _mm_stream_si128(reinterpret_cast<__m128i*>(d + i + 16), b);
+        _mm_stream_si128(reinterpret_cast<__m128i*>(d + i + 32), c);
+        _mm_stream_si128(reinterpret_cast<__m128i*>(d + i + 48), e);
+    }
+    std::memcpy(d + i, s + i, bytes - i);
+    _mm_sfence();
+}
+
+/**
+ * \brief Turn the 2 copies of the most significant byte in the upper 16 bits of each 64 bits lane into 0x0000 or 0xFFFF.
+ */
+ENDN_TARGET_SSSE3 inline __m128i sign_fix48(const __m128i value)
+{
+    const __m128i low = _mm_set_epi16(0, -1, -1, -1, 0, -1, -1, -1);
+    return _mm_or_si128(_mm_and_si128(value, low), _mm_andnot_si128(low, _mm_srai_epi16(value, 15)));
+}
+
+template<Order order, bool Signed>
+ENDN_TARGET_SSSE3 inline void unpack48_ssse3(std::uint64_t* dest, const std::uint8_t* src, const std::size_t count)
+{
+    const __m128i shuffle = _mm_loadu_si128(reinterpret_cast<const __m128i*>(unpack48_shuffle<order, Signed>()));
+    const std::size_t bytes = count * UINT48_SIZE;
+    std::size_t i = 0;
+    // Each 16 bytes load hold 2 integers, the 4 last bytes are read again by the next load
+    for(; i * UINT48_SIZE + 16 <= bytes; i += 2)
+    {
+        const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i * UINT48_SIZE));
+        __m128i b = _mm_shuffle_epi8(a, shuffle);
+        if(Signed)
+            b = sign_fix48(b);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dest + i), b);
+    }
+    unpack48_scalar<order, Signed>(dest + i, src + i * UINT48_SIZE, count - i);
+}
+
+template<Order order>
+ENDN_TARGET_SSSE3 inline void pack48_ssse3(std::uint8_t* dest, const std::uint64_t* src, const std::size_t count)
+{
+    const __m128i shuffle = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pack48_shuffle<order>()));
+    const std::size_t bytes = count * UINT48_SIZE;
+    std::size_t i = 0;
+    // Each 16 bytes store write 2 integers followed by 4 zero bytes, overwritten by the next store
+    for(; i * UINT48_SIZE + 16 <= bytes; i += 2)
+    {
+        const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dest + i * UINT48_SIZE), _mm_shuffle_epi8(a, shuffle));
+    }
+    pack48_scalar<order>(dest + i * UINT48_SIZE, src + i, count - i);
+}
+
+template<Order order, bool Signed>
+ENDN_TARGET_AVX2 inline void unpack48_avx2(std::uint64_t* dest, const std::uint8_t* src, const std::size_t count)
+{
+    const __m256i shuffle = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(unpack48_shuffle<order, Signed>()));
+    const __m256i low = _mm256_set_epi16(0, -1, -1, -1, 0, -1, -1, -1, 0, -1, -1, -1, 0, -1, -1, -1);
+    // Bytes 0..15 go in the low lane, 12..27 in the high lane
+    const __m256i spread = _mm256_setr_epi32(0, 1, 2, 3, 3, 4, 5, 6);
+    const std::size_t bytes = count * UINT48_SIZE;
+    std::size_t i = 0;
+    for(; i * UINT48_SIZE + 32 <= bytes; i += 4)
+    {
+        const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i * UINT48_SIZE));
+        __m256i b = _mm256_shuffle_epi8(_mm256_permutevar8x32_epi32(a, spread), shuffle);
+        if(Signed)
+            b = _mm256_blendv_epi8(_mm256_srai_epi16(b, 15), b, low);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dest + i), b);
+    }
+    unpack48_ssse3<order, Signed>(dest + i, src + i * UINT48_SIZE, count - i);
+}
+
+template<Order order>
+ENDN_TARGET_AVX2 inline void pack48_avx2(std::uint8_t* dest, const std::uint64_t* src, const std::size_t count)
+{
+    const __m256i shuffle = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pack48_shuffle<order>()));
+    // Join the 12 packed bytes of each lane
+    const __m256i join = _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 7, 7);
+    const std::size_t bytes = count * UINT48_SIZE;
+    std::size_t i = 0;
+    for(; i * UINT48_SIZE + 32 <= bytes; i += 4)
+    {
+        const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+        const __m256i b = _mm256_permutevar8x32_epi32(_mm256_shuffle_epi8(a, shuffle), join);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dest + i * UINT48_SIZE), b);
+    }
+    pack48_ssse3<order>(dest + i * UINT48_SIZE, src + i, count - i);
+}
+
+template<Order order, bool Signed>
+ENDN_TARGET_SSSE3 inline void unpack24_ssse3(std::uint32_t* dest, const std::uint8_t* src, const std::size_t count)
+{
+    const __m128i shuffle = _mm_loadu_si128(reinterpret_cast<const __m128i*>(unpack24_shuffle<order>()));
+    const std::size_t bytes = count * UINT24_SIZE;
+    std::size_t i = 0;
+    // Each 16 bytes load hold 4 integers, the 4 last bytes are read again by the next load
+    for(; i * UINT24_SIZE + 16 <= bytes; i += 4)
+    {
+        const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i * UINT24_SIZE));
+        const __m128i b = _mm_shuffle_epi8(a, shuffle);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dest + i), Signed ? _mm_srai_epi32(b, 8) : _mm_srli_epi32(b, 8));
+    }
+    unpack24_scalar<order, Signed>(dest + i, src + i * UINT24_SIZE, count - i);
+}
+
+template<Order order>
+ENDN_TARGET_SSSE3 inline void pack24_ssse3(std::uint8_t* dest, const std::uint32_t* src, const std::size_t count)
+{
+    const __m128i shuffle = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pack24_shuffle<order>()));
+    const std::size_t bytes = count * UINT24_SIZE;
+    std::size_t i = 0;
+    // Each 16 bytes store write 4 integers followed by 4 zero bytes, overwritten by the next store
+    for(; i * UINT24_SIZE + 16 <= bytes; i += 4)
+    {
+        const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dest + i * UINT24_SIZE), _mm_shuffle_epi8(a, shuffle));
+    }
+    pack24_scalar<order>(dest + i * UINT24_SIZE, src + i, count - i);
+}
+
+template<Order order, bool Signed>
+ENDN_TARGET_AVX2 inline void unpack24_avx2(std::uint32_t* dest, const std::uint8_t* src, const std::size_t count)
+{
+    const __m256i shuffle = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(unpack24_shuffle<order>()));
+    // Bytes 0..15 go in the low lane, 12..27 in the high lane
+    const __m256i spread = _mm256_setr_epi32(0, 1, 2, 3, 3, 4, 5, 6);
+    const std::size_t bytes = count * UINT24_SIZE;
+    std::size_t i = 0;
+    for(; i * UINT24_SIZE + 32 <= bytes; i += 8)
+    {
+        const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i * UINT24_SIZE));
+        const __m256i b = _mm256_shuffle_epi8(_mm256_permutevar8x32_epi32(a, spread), shuffle);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dest + i), Signed ? _mm256_srai_epi32(b, 8) : _mm256_srli_epi32(b, 8));
+    }
+    unpack24_ssse3<order, Signed>(dest + i, src + i * UINT24_SIZE, count - i);
+}
+
+template<Order order>
+ENDN_TARGET_AVX2 inline void pack24_avx2(std::uint8_t* dest, const std::uint32_t* src, const std::size_t count)
+{
+    const __m256i shuffle = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pack24_shuffle<order>()));
+    // Join the 12 packed bytes of each lane
+    const __m256i join = _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 7, 7);
+    const std::size_t bytes = count * UINT24_SIZE;
+    std::size_t i = 0;
+    for(; i * UINT24_SIZE + 32 <= bytes; i += 8)
+    {
+        const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+        const __m256i b = _mm256_permutevar8x32_epi32(_mm256_shuffle_epi8(a, shuffle), join);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dest + i * UINT24_SIZE), b);
+    }
+    pack24_ssse3<order>(dest + i * UINT24_SIZE, src + i, count - i);
+}
+
+template<Order order>
+ENDN_TARGET_SSSE3 inline void unpack_bfloat16_ssse3(float* dest, const std::uint8_t* src, const std::size_t count)
+{
+    const __m128i shuffle = _mm_loadu_si128(reinterpret_cast<const __m128i*>(unpack_bfloat16_shuffle<order>()));
+    std::size_t i = 0;
+    for(; i + 4 <= count; i += 4)
+    {
+        const __m128i a = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(src + i * BFLOAT16_SIZE));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dest + i), _mm_shuffle_epi8(a, shuffle));
+    }
+    unpack_bfloat16_scalar<order>(dest + i, src + i * BFLOAT16_SIZE, count - i);
+}
+
+/**
+ * \brief Round 4 floats to nearest even in their 16 msb. NaN are kept quiet instead.
+ */
+ENDN_TARGET_SSSE3 inline __m128i round_bfloat16_ssse3(const __m128i a)
+{
+    const __m128i lsb = _mm_and_si128(_mm_srli_epi32(a, 16), _mm_set1_epi32(1));
+    const __m128i rounded = _mm_add_epi32(a, _mm_add_epi32(_mm_set1_epi32(0x7FFF), lsb));
+    const __m128i nan = _mm_cmpgt_epi32(_mm_and_si128(a, _mm_set1_epi32(0x7FFFFFFF)), _mm_set1_epi32(0x7F800000));
+    return _mm_or_si128(_mm_and_si128(nan, _mm_or_si128(a, _mm_set1_epi32(0x400000))), _mm_andnot_si128(nan, rounded));
+}
+
+template<Order order>
+ENDN_TARGET_SSSE3 inline void pack_bfloat16_ssse3(std::uint8_t* dest, const float* src, const std::size_t count)
+{
+    const __m128i shuffle = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pack_bfloat16_shuffle<order>()));
+    std::size_t i = 0;
+    for(; i + 4 <= count; i += 4)
+    {
+        const __m128i a = round_bfloat16_ssse3(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i)));
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(dest + i * BFLOAT16_SIZE), _mm_shuffle_epi8(a, shuffle));
+    }
+    pack_bfloat16_scalar<order>(dest + i * BFLOAT16_SIZE, src + i, count - i);
+}
+
+template<Order order>
+ENDN_TARGET_AVX2 inline void unpack_bfloat16_avx2(float* dest, const std::uint8_t* src, const std::size_t count)
+{
+    const __m128i swap = _mm_loadu_si128(reinterpret_cast<const __m128i*>(swap_shuffle<std::uint16_t>()));
+    std::size_t i = 0;
+    for(; i + 8 <= count; i += 8)
+    {
+        __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i * BFLOAT16_SIZE));
+        if(order != HOST_ORDER)
+            a = _mm_shuffle_epi8(a, swap);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dest + i), _mm256_slli_epi32(_mm256_cvtepu16_epi32(a), 16));
+    }
+    unpack_bfloat16_ssse3<order>(dest + i, src + i * BFLOAT16_SIZE, count - i);
+}
+
+/**
+ * \brief Round 8 floats to nearest even in their 16 msb. NaN are kept quiet instead.
+ */
+ENDN_TARGET_AVX2 inline __m256i round_bfloat16_avx2(const __m256i a)
+{
+    const __m256i lsb = _mm256_and_si256(_mm256_srli_epi32(a, 16), _mm256_set1_epi32(1));
+    const __m256i rounded = _mm256_add_epi32(a, _mm256_add_epi32(_mm256_set1_epi32(0x7FFF), lsb));
+    const __m256i nan = _mm256_cmpgt_epi32(_mm256_and_si256(a, _mm256_set1_epi32(0x7FFFFFFF)), _mm256_set1_epi32(0x7F800000));
+    return _mm256_blendv_epi8(rounded, _mm256_or_si256(a, _mm256_set1_epi32(0x400000)), nan);
+}
+
+template<Order order>
+ENDN_TARGET_AVX2 inline void pack_bfloat16_avx2(std::uint8_t* dest, const float* src, const std::size_t count)
+{
+    const __m256i shuffle = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pack_bfloat16_shuffle<order>()));
+    std::size_t i = 0;
+    for(; i + 8 <= count; i += 8)
+    {
+        const __m256i b = round_bfloat16_avx2(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i)));
+        // Join the 8 packed bytes of each lane
+        const __m256i c = _mm256_permute4x64_epi64(_mm256_shuffle_epi8(b, shuffle), 0x08);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dest + i * BFLOAT16_SIZE), _mm256_castsi256_si128(c));
+    }
+    pack_bfloat16_ssse3<order>(dest + i * BFLOAT16_SIZE, src + i, count - i);
+}
+
+template<Order order>
+ENDN_TARGET_F16C inline void unpack_float16_f16c(float* dest, const std::uint8_t* src, const std::size_t count)
+{
+    const __m128i swap = _mm_loadu_si128(reinterpret_cast<const __m128i*>(swap_shuffle<std::uint16_t>()));
+    std::size_t i = 0;
+    for(; i + 8 <= count; i += 8)
+    {
+        __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i * FLOAT16_SIZE));
+        if(order != HOST_ORDER)
+            a = _mm_shuffle_epi8(a, swap);
+        _mm256_storeu_ps(dest + i, _mm256_cvtph_ps(a));
+    }
+    unpack_float16_scalar<order>(dest + i, src + i * FLOAT16_SIZE, count - i);
+}
+
+template<Order order>
+ENDN_TARGET_F16C inline void pack_float16_f16c(std::uint8_t* dest, const float* src, const std::size_t count)
+{
+    const __m128i swap = _mm_loadu_si128(reinterpret_cast<const __m128i*>(swap_shuffle<std::uint16_t>()));
+    std::size_t i = 0;
+    for(; i + 8 <= count; i += 8)
+    {
+        __m128i a = _mm256_cvtps_ph(_mm256_loadu_ps(src + i), _MM_FROUND_TO_NEAREST_INT);
+        if(order != HOST_ORDER)
+            a = _mm_shuffle_epi8(a, swap);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dest + i * FLOAT16_SIZE), a);
+    }
+    pack_float16_scalar<order>(dest + i * FLOAT16_SIZE, src + i, count - i);
+}
+
+/**
+ * \brief Load bytes (8, 16 or 32) in the low bytes of a 256 bits register
+ */
+ENDN_TARGET_AVX2 inline __m256i load_part_avx2(const void* src, const std::size_t bytes)
+{
+    if(bytes == 32)
+        return _mm256_loadu_si256(static_cast<const __m256i*>(src));
+    if(bytes == 16)
+        return _mm256_castsi128_si256(_mm_loadu_si128(static_cast<const __m128i*>(src)));
+    return _mm256_castsi128_si256(_mm_loadl_epi64(static_cast<const __m128i*>(src)));
+}
+
+/**
+ * \brief Store the bytes (8, 16 or 32) low bytes of a 256 bits register
+ */
+ENDN_TARGET_AVX2 inline void store_part_avx2(void* dest, const __m256i a, const std::size_t bytes)
+{
+    if(bytes == 32)
+        _mm256_storeu_si256(static_cast<__m256i*>(dest), a);
+    else if(bytes == 16)
+        _mm_storeu_si128(static_cast<__m128i*>(dest), _mm256_castsi256_si128(a));
+    else
+        _mm_storel_epi64(static_cast<__m128i*>(dest), _mm256_castsi256_si128(a));
+}
+
+inline std::size_t count_bits(unsigned mask)
+{
+    std::size_t n = 0;
+    for(; mask; mask &= mask - 1)
+        ++n;
+    return n;
+}
+
+/**
+ * \brief Convert the host ordered elements of a, 32 bytes of the widest of From and To per call
+ */
+template<std::size_t From, std::size_t To>
+ENDN_TARGET_AVX2 inline __m256i convert_avx2(const __m256i a, std::size_t&, convert_tag<CONVERT_ZERO_EXTEND, From, To>)
+{
+    const __m128i b = _mm256_castsi256_si128(a);
+    return From == 4 ? _mm256_cvtepu32_epi64(b) : To == 4 ? _mm256_cvtepu16_epi32(b) : _mm256_cvtepu16_epi64(b);
+}
+
+template<std::size_t From, std::size_t To>
+ENDN_TARGET_AVX2 inline __m256i convert_avx2(const __m256i a, std::size_t&, convert_tag<CONVERT_SIGN_EXTEND, From, To>)
+{
+    const __m128i b = _mm256_castsi256_si128(a);
+    return From == 4 ? _mm256_cvtepi32_epi64(b) : To == 4 ? _mm256_cvtepi16_epi32(b) : _mm256_cvtepi16_epi64(b);
+}
+
+ENDN_TARGET_AVX2 inline __m256i convert_avx2(const __m256i a, std::size_t&, convert_tag<CONVERT_FLOAT_EXTEND, 4, 8>)
+{
+    return _mm256_castpd_si256(_mm256_cvtps_pd(_mm_castsi128_ps(_mm256_castsi256_si128(a))));
+}
+
+ENDN_TARGET_AVX2 inline __m256i convert_avx2(const __m256i a, std::size_t& saturated, convert_tag<CONVERT_FLOAT_NARROW, 8, 4>)
+{
+    const __m256d d = _mm256_castsi256_pd(a);
+    const __m128 f = _mm256_cvtpd_ps(d);
+    // Finite double that rounded to an infinity
+    const __m256d absd = _mm256_andnot_pd(_mm256_set1_pd(-0.0), d);
+    const __m128 absf = _mm_andnot_ps(_mm_set1_ps(-0.0f), f);
+    const int infd = _mm256_movemask_pd(_mm256_cmp_pd(absd, _mm256_set1_pd(HUGE_VAL), _CMP_EQ_OQ));
+    const int inff = _mm_movemask_ps(_mm_cmpeq_ps(absf, _mm_set1_ps(HUGE_VALF)));
+    saturated += count_bits(unsigned(inff & ~infd));
+    return _mm256_castsi128_si256(_mm_castps_si128(f));
+}
+
+ENDN_TARGET_AVX2 inline __m256i convert_avx2(const __m256i a, std::size_t& saturated, convert_tag<CONVERT_UINT_NARROW, 8, 4>)
+{
+    // No unsigned 64 bits compare, flip the sign bits to use the signed one
+    const __m256i sign = _mm256_set1_epi64x(std::numeric_limits<int64_t>::min());
+    const __m256i high = _mm256_set1_epi64x(0xFFFFFFFF ^ std::numeric_limits<int64_t>::min());
+    const __m256i over = _mm256_cmpgt_epi64(_mm256_xor_si256(a, sign), high);
+    saturated += count_bits(unsigned(_mm256_movemask_pd(_mm256_castsi256_pd(over))));
+    return _mm256_permutevar8x32_epi32(_mm256_or_si256(a, over), _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6));
+}
+
+ENDN_TARGET_AVX2 inline __m256i convert_avx2(const __m256i a, std::size_t& saturated, convert_tag<CONVERT_UINT_NARROW, 4, 2>)
+{
+    const __m256i b = _mm256_min_epu32(a, _mm256_set1_epi32(0xFFFF));
+    saturated += 8 - count_bits(unsigned(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(a, b)))));
+    return _mm256_castsi128_si256(_mm_packus_epi32(_mm256_castsi256_si128(b), _mm256_extracti128_si256(b, 1)));
+}
+
+/**
+ * \brief Wire of the given order to host T with AVX2, in a single pass: swap, then widen or narrow.
+ * Conversions without kernel use the scalar loop.
+ */
+template<typename Wire, Order order, typename T, std::size_t From, std::size_t To>
+inline std::size_t unpack_convert_avx2(T* dest, const std::uint8_t* src, const std::size_t count, convert_tag<CONVERT_SCALAR, From, To>)
+{
+    return unpack_convert_scalar<Wire, order>(dest, src, count);
+}
+
+template<typename Wire, Order order, typename T, int Kind, std::size_t From, std::size_t To>
+ENDN_TARGET_AVX2 inline std::size_t unpack_convert_avx2(
+    T* dest, const std::uint8_t* src, const std::size_t count, const convert_tag<Kind, From, To> tag)
+{
+    const __m256i swap = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(swap_shuffle<Wire>()));
+    const std::size_t step = 32 / (From > To ? From : To);
+    std::size_t saturated = 0;
+    std::size_t i = 0;
+    for(; i + step <= count; i += step)
+    {
+        __m256i a = load_part_avx2(src + i * From, step * From);
+        if(order != HOST_ORDER)
+            a = _mm256_shuffle_epi8(a, swap);
+        store_part_avx2(dest + i, convert_avx2(a, saturated, tag), step * To);
+    }
+    return saturated + unpack_convert_scalar<Wire, order>(dest + i, src + i * From, count - i);
+}
+
+/**
+ * \brief Host T to Wire of the given order with AVX2, in a single pass: widen or narrow, then swap.
+ * Conversions without kernel use the scalar loop.
+ */
+template<typename Wire, Order order, typename T, std::size_t From, std::size_t To>
+inline std::size_t pack_convert_avx2(std::uint8_t* dest, const T* src, const std::size_t count, convert_tag<CONVERT_SCALAR, From, To>)
+{
+    return pack_convert_scalar<Wire, order>(dest, src, count);
+}
+
+template<typename Wire, Order order, typename T, int Kind, std::size_t From, std::size_t To>
+ENDN_TARGET_AVX2 inline std::size_t pack_convert_avx2(
+    std::uint8_t* dest, const T* src, const std::size_t count, const convert_tag<Kind, From, To> tag)
+{
+    const __m256i swap = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(swap_shuffle<Wire>()));
+    const std::size_t step = 32 / (From > To ? From : To);
+    std::size_t saturated = 0;
+    std::size_t i = 0;
+    for(; i + step <= count; i += step)
+    {
+        __m256i a = convert_avx2(load_part_avx2(src + i, step * From), saturated, tag);
+        if(order != HOST_ORDER)
+            a = _mm256_shuffle_epi8(a, swap);
+        store_part_avx2(dest + i * To, a, step * To);
+    }
+    return saturated + pack_convert_scalar<Wire, order>(dest + i * To, src + i, count - i);
+}
+
+/**
+ * \brief Fixed point to float or double with AVX2, selected on the wire integer.
+ * 8 bits and unsigned formats have no kernel and use the scalar loop.
+ */
+template<typename Format, Order order, typename T, typename Int>
+inline void unpack_fixed_avx2(T* dest, const std::uint8_t* src, const std::size_t count, Int)
+{
+    unpack_fixed_scalar<Format, order>(dest, src, count);
+}
+
+template<typename Format, Order order>
+ENDN_TARGET_AVX2 inline void unpack_fixed_avx2(float* dest, const std::uint8_t* src, const std::size_t count, int16_t)
+{
+    const __m128i swap = _mm_loadu_si128(reinterpret_cast<const __m128i*>(swap_shuffle<std::uint16_t>()));
+    const __m256 scale = _mm256_set1_ps(fixed_scale<float>(Format::FRACTION));
+    std::size_t i = 0;
+    for(; i + 8 <= count; i += 8)
+    {
+        __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i * INT16_SIZE));
+        if(order != HOST_ORDER)
+            a = _mm_shuffle_epi8(a, swap);
+        _mm256_storeu_ps(dest + i, _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(a)), scale));
+    }
+    unpack_fixed_scalar<Format, order>(dest + i, src + i * INT16_SIZE, count - i);
+}
+
+template<typename Format, Order order>
+ENDN_TARGET_AVX2 inline void unpack_fixed_avx2(double* dest, const std::uint8_t* src, const std::size_t count, int16_t)
+{
+    const __m128i swap = _mm_loadu_si128(reinterpret_cast<const __m128i*>(swap_shuffle<std::uint16_t>()));
+    const __m256d scale = _mm256_set1_pd(fixed_scale<double>(Format::FRACTION));
+    std::size_t i = 0;
+    for(; i + 4 <= count; i += 4)
+    {
+        __m128i a = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(src + i * INT16_SIZE));
+        if(order != HOST_ORDER)
+            a = _mm_shuffle_epi8(a, swap);
+        _mm256_storeu_pd(dest + i, _mm256_mul_pd(_mm256_cvtepi32_pd(_mm_cvtepi16_epi32(a)), scale));
+    }
+    unpack_fixed_scalar<Format, order>(dest + i, src + i * INT16_SIZE, count - i);
+}
+
+template<typename Format, Order order>
+ENDN_TARGET_AVX2 inline void unpack_fixed_avx2(float* dest, const std::uint8_t* src, const std::size_t count, int32_t)
+{
+    const __m256i swap = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(swap_shuffle<std::uint32_t>()));
+    const __m256 scale = _mm256_set1_ps(fixed_scale<float>(Format::FRACTION));
+    std::size_t i = 0;
+    for(; i + 8 <= count; i += 8)
+    {
+        __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i * INT32_SIZE));
+        if(order != HOST_ORDER)
+            a = _mm256_shuffle_epi8(a, swap);
+        _mm256_storeu_ps(dest + i, _mm256_mul_ps(_mm256_cvtepi32_ps(a), scale));
+    }
+    unpack_fixed_scalar<Format, order>(dest + i, src + i * INT32_SIZE, count - i);
+}
+
+template<typename Format, Order order>
+ENDN_TARGET_AVX2 inline void unpack_fixed_avx2(double* dest, const std::uint8_t* src, const std::size_t count, int32_t)
+{
+    const __m128i swap = _mm_loadu_si128(reinterpret_cast<const __m128i*>(swap_shuffle<std::uint32_t>()));
+    const __m256d scale = _mm256_set1_pd(fixed_scale<double>(Format::FRACTION));
+    std::size_t i = 0;
+    for(; i + 4 <= count; i += 4)
+    {
+        __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i * INT32_SIZE));
+        if(order != HOST_ORDER)
+            a = _mm_shuffle_epi8(a, swap);
+        _mm256_storeu_pd(dest + i, _mm256_mul_pd(_mm256_cvtepi32_pd(a), scale));
+    }
+    unpack_fixed_scalar<Format, order>(dest + i, src + i * INT32_SIZE, count - i);
+}
+
+/**
+ * \brief Float or double to fixed point with AVX2. NaN are zeroed and the values clamped before the
+ * conversion (round to nearest even), so every lane saturate like the scalar loop.
+ */
+template<typename Format, Order order, typename T, typename Int>
+inline void pack_fixed_avx2(std::uint8_t* dest, const T* src, const std::size_t count, Int)
+{
+    pack_fixed_scalar<Format, order>(dest, src, count);
+}
+
+template<typename Format, Order order>
+ENDN_TARGET_AVX2 inline void pack_fixed_avx2(std::uint8_t* dest, const float* src, const std::size_t count, int16_t)
+{
+    const __m128i swap = _mm_loadu_si128(reinterpret_cast<const __m128i*>(swap_shuffle<std::uint16_t>()));
+    const __m256 scale = _mm256_set1_ps(float(std::uint64_t(1) << Format::FRACTION));
+    const __m256 low = _mm256_set1_ps(-32768.0f);
+    const __m256 high = _mm256_set1_ps(32767.0f);
+    std::size_t i = 0;
+    for(; i + 8 <= count; i += 8)
+    {
+        __m256 v = _mm256_mul_ps(_mm256_loadu_ps(src + i), scale);
+        v = _mm256_and_ps(v, _mm256_cmp_ps(v, v, _CMP_ORD_Q));
+        const __m256i a = _mm256_cvtps_epi32(_mm256_min_ps(_mm256_max_ps(v, low), high));
+        // Pack each lane then join the 8 bytes of both lanes
+        __m128i b = _mm256_castsi256_si128(_mm256_permute4x64_epi64(_mm256_packs_epi32(a, a), 0x08));
+        if(order != HOST_ORDER)
+            b = _mm_shuffle_epi8(b, swap);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dest + i * INT16_SIZE), b);
+    }
+    pack_fixed_scalar<Format, order>(dest + i * INT16_SIZE, src + i, count - i);
+}
+
+template<typename Format, Order order>
+ENDN_TARGET_AVX2 inline void pack_fixed_avx2(std::uint8_t* dest, const double* src, const std::size_t count, int16_t)
+{
+    const __m128i swap = _mm_loadu_si128(reinterpret_cast<const __m128i*>(swap_shuffle<std::uint16_t>()));
+    const __m256d scale = _mm256_set1_pd(double(std::uint64_t(1) << Format::FRACTION));
+    const __m256d low = _mm256_set1_pd(-32768.0);
+    const __m256d high = _mm256_set1_pd(32767.0);
+    std::size_t i = 0;
+    for(; i + 4 <= count; i += 4)
+    {
+        __m256d v = _mm256_mul_pd(_mm256_loadu_pd(src + i), scale);
+        v = _mm256_and_pd(v, _mm256_cmp_pd(v, v, _CMP_ORD_Q));
+        const __m128i a = _mm256_cvtpd_epi32(_mm256_min_pd(_mm256_max_pd(v, low), high));
+        __m128i b = _mm_packs_epi32(a, a);
+        if(order != HOST_ORDER)
+            b = _mm_shuffle_epi8(b, swap);
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(dest + i * INT16_SIZE), b);
+    }
+    pack_fixed_scalar<Format, order>(dest + i * INT16_SIZE, src + i, count - i);
+}
+
+template<typename Format, Order order>
+ENDN_TARGET_AVX2 inline void pack_fixed_avx2(std::uint8_t* dest, const float* src, const std::size_t count, int32_t)
+{
+    const __m256i swap = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(swap_shuffle<std::uint32_t>()));
+    const __m256 scale = _mm256_set1_ps(float(std::uint64_t(1) << Format::FRACTION));
+    const __m256 low = _mm256_set1_ps(-2147483648.0f);
+    std::size_t i = 0;
+    for(; i + 8 <= count; i += 8)
+    {
+        __m256 v = _mm256_mul_ps(_mm256_loadu_ps(src + i), scale);
+        v = _mm256_and_ps(v, _mm256_cmp_ps(v, v, _CMP_ORD_Q));
+        // 2^31 and above convert to 0x80000000, flipped to 0x7FFFFFFF
+        const __m256i over = _mm256_castps_si256(_mm256_cmp_ps(v, _mm256_sub_ps(_mm256_setzero_ps(), low), _CMP_GE_OQ));
+        __m256i a = _mm256_xor_si256(_mm256_cvtps_epi32(_mm256_max_ps(v, low)), over);
+        if(order != HOST_ORDER)
+            a = _mm256_shuffle_epi8(a, swap);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dest + i * INT32_SIZE), a);
+    }
+    pack_fixed_scalar<Format, order>(dest + i * INT32_SIZE, src + i, count - i);
+}
+
+template<typename Format, Order order>
+ENDN_TARGET_AVX2 inline void pack_fixed_avx2(std::uint8_t* dest, const double* src, const std::size_t count, int32_t)
+{
+    const __m128i swap = _mm_loadu_si128(reinterpret_cast<const __m128i*>(swap_shuffle<std::uint32_t>()));
+    const __m256d scale = _mm256_set1_pd(double(std::uint64_t(1) << Format::FRACTION));
+    const __m256d low = _mm256_set1_pd(-2147483648.0);
+    const __m256d high = _mm256_set1_pd(2147483647.0);
+    std::size_t i = 0;
+    for(; i + 4 <= count; i += 4)
+    {
+        __m256d v = _mm256_mul_pd(_mm256_loadu_pd(src + i), scale);
+        v = _mm256_and_pd(v, _mm256_cmp_pd(v, v, _CMP_ORD_Q));
+        __m128i a = _mm256_cvtpd_epi32(_mm256_min_pd(_mm256_max_pd(v, low), high));
+        if(order != HOST_ORDER)
+            a = _mm_shuffle_epi8(a, swap);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dest + i * INT32_SIZE), a);
+    }
+    pack_fixed_scalar<Format, order>(dest + i * INT32_SIZE, src + i, count - i);
+}
+
+/**
+ * \brief Gather 8 std::uint32_t per iteration with two 64 bits indexed vpgatherqd, prefetching the next fields.
+ * std::size_t must be 64 bits.
+ */
+template<Order order>
+ENDN_TARGET_AVX2 inline void gather32_avx2(
+    std::uint32_t* dest, const std::uint8_t* src, const std::size_t* offsets, const std::size_t count)
+{
+    const __m256i shuffle = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(swap_shuffle<std::uint32_t>()));
+    const int* base = reinterpret_cast<const int*>(src);
+    std::size_t i = 0;
+    for(; i + 8 <= count; i += 8)
+    {
+        for(std::size_t j = i + GATHER_PREFETCH_DISTANCE; j < i + GATHER_PREFETCH_DISTANCE + 8 && j < count; ++j)
+            ENDN_PREFETCH(src + offsets[j]);
+        const __m128i low = _mm256_i64gather_epi32(base, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(offsets + i)), 1);
+        const __m128i high = _mm256_i64gather_epi32(base, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(offsets + i + 4)), 1);
+        __m256i a = _mm256_inserti128_si256(_mm256_castsi128_si256(low), high, 1);
+        if(order != HOST_ORDER)
+            a = _mm256_shuffle_epi8(a, shuffle);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dest + i), a);
+    }
+    gather_scalar<std::uint32_t, order>(dest + i, src, offsets + i, count - i);
+}
+
+/**
+ * \brief Gather 4 std::uint64_t per iteration with a 64 bits indexed vpgatherqq, prefetching the next fields.
+ * std::size_t must be 64 bits.
+ */
+template<Order order>
+ENDN_TARGET_AVX2 inline void gather64_avx2(
+    std::uint64_t* dest, const std::uint8_t* src, const std::size_t* offsets, const std::size_t count)
+{
+    const __m256i shuffle = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(swap_shuffle<std::uint64_t>()));
+    const long long* base = reinterpret_cast<const long long*>(src);
+    std::size_t i = 0;
+    for(; i + 4 <= count; i += 4)
+    {
+        for(std::size_t j = i + GATHER_PREFETCH_DISTANCE; j < i + GATHER_PREFETCH_DISTANCE + 4 && j < count; ++j)
+            ENDN_PREFETCH(src + offsets[j]);
+        __m256i a = _mm256_i64gather_epi64(base, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(offsets + i)), 1);
+        if(order != HOST_ORDER)
+            a = _mm256_shuffle_epi8(a, shuffle);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dest + i), a);
+    }
+    gather_scalar<std::uint64_t, order>(dest + i, src, offsets + i, count - i);
+}
+
+template<Order order>
+ENDN_TARGET_AVX2 inline void extract32_avx2(
+    std::uint32_t* dest, const std::uint8_t* src, const std::size_t stride, const std::size_t count)
+{
+    const __m256i shuffle = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(swap_shuffle<std::uint32_t>()));
+    // Offsets are relative to the first record of each block, so only 7 * stride need to fit in an int
+    const int s = int(stride);
+    const __m256i index = _mm256_setr_epi32(0, s, 2 * s, 3 * s, 4 * s, 5 * s, 6 * s, 7 * s);
+    std::size_t i = 0;
+    for(; i + 8 <= count; i += 8, src += 8 * stride)
+    {
+        __m256i a = _mm256_i32gather_epi32(reinterpret_cast<const int*>(src), index, 1);
+        if(order != HOST_ORDER)
+            a = _mm256_shuffle_epi8(a, shuffle);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dest + i), a);
+    }
+    extract_scalar<std::uint32_t, order>(dest + i, src, stride, count - i);
+}
+
+template<Order order>
+ENDN_TARGET_AVX2 inline void extract64_avx2(
+    std::uint64_t* dest, const std::uint8_t* src, const std::size_t stride, const std::size_t count)
+{
+    const __m256i shuffle = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(swap_shuffle<std::uint64_t>()));
+    const int s = int(stride);
+    const __m128i index = _mm_setr_epi32(0, s, 2 * s, 3 * s);
+    std::size_t i = 0;
+    for(; i + 4 <= count; i += 4, src += 4 * stride)
+    {
+        __m256i a = _mm256_i32gather_epi64(reinterpret_cast<const long long*>(src), index, 1);
+        if(order != HOST_ORDER)
+            a = _mm256_shuffle_epi8(a, shuffle);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dest + i), a);
+    }
+    extract_scalar<std::uint64_t, order>(dest + i, src, stride, count - i);
+}
+
+#endif
+
+// ─────────────────────────────────────────────────────────────
+//                  DISPATCH
+// ─────────────────────────────────────────────────────────────
+
+inline bool simd_supported(const Simd simd)
+{
+    switch(simd)
+    {
+    case Simd::SCALAR:
+        return true;
+#ifdef ENDN_SIMD_X86
+    case Simd::SSSE3:
+        return (cached_cpu_features() & CPU_SSSE3) != 0;
+    case Simd::AVX2:
+        return (cached_cpu_features() & CPU_AVX2) != 0;
+#endif
+#ifdef ENDN_SIMD_VECTOR
+    case Simd::VECTOR:
+        return true;
+#endif
+    default:
+        return false;
+    }
+}
+
+inline Simd best_simd()
+{
+    if(simd_supported(Simd::AVX2))
+        return Simd::AVX2;
+    if(simd_supported(Simd::SSSE3))
+        return Simd::SSSE3;
+    if(simd_supported(Simd::VECTOR))
+        return Simd::VECTOR;
+    return Simd::SCALAR;
+}
+
+/**
+ * \brief Currently selected instruction set. Detected once on first use.
+ */
+inline std::atomic<std::uint8_t>& simd_selected()
+{
+    static std::atomic<std::uint8_t> selected {static_cast<std::uint8_t>(best_simd())};
+    return selected;
+}
+
+/**
+ * \brief Size (in bytes) from which bulk conversions use non-temporal stores.
+ */
+inline std::atomic<std::size_t>& streaming_threshold()
+{
+    static std::atomic<std::size_t> threshold {std::size_t(ENDN_STREAMING_THRESHOLD)};
+    return threshold;
+}
+
+/**
+ * \brief Size (in bytes) of the whole transfer the conversions of this thread are a chunk of, 0 when they aren't.
+ */
+inline std::size_t& transfer_size()
+{
+    static thread_local std::size_t bytes = 0;
+    return bytes;
+}
+
+/**
+ * \brief Mark the conversions of this thread as a chunk of a transfer of bytes, until the end of the scope.
+ * The streaming threshold is then compared to the whole transfer instead of each chunk.
+ */
+class transfer_scope
+{
+public:
+    explicit transfer_scope(const std::size_t bytes) : _previous(transfer_size())
+    {
+        transfer_size() = bytes;
+    }
+
+    transfer_scope(const transfer_scope&) = delete;
+    transfer_scope& operator=(const transfer_scope&) = delete;
+
+    ~transfer_scope()
+    {
+        transfer_size() = _previous;
+    }
+
+private:
+    std::size_t _previous;
+};
+
+/**
+ * \brief Check if a conversion of bytes into dest should bypass the cache.
+ * Non-temporal stores need aligned vectors, so dest must be at least aligned on its element size.
+ */
+inline bool use_streaming(const void* dest, const std::size_t bytes, const std::size_t alignment)
+{
+    const std::size_t transfer = transfer_size();
+    return (transfer > bytes ? transfer : bytes) >= streaming_threshold().load(std::memory_order_relaxed) &&
+           std::uintptr_t(dest) % alignment == 0 && Simd(simd_selected().load(std::memory_order_relaxed)) != Simd::SCALAR;
+}
+
+/**
+ * \brief Copy bytes from src to dest when no swap is required. src and dest can overlap.
+ */
+inline void copy_array(void* dest, const void* src, const std::size_t bytes)
+{
+    // An empty array may come with null pointers, that memcpy and memmove don't accept even for 0 bytes
+    if(bytes == 0)
+        return;
+    if(OVERLAP(std::uintptr_t(dest), std::uintptr_t(src), bytes))
+        std::memmove(dest, src, bytes);
+#ifdef ENDN_SIMD_X86
+    else if(use_streaming(dest, bytes, 1))
+        copy_stream(dest, src, bytes);
+#endif
+    else
+        std::memcpy(dest, src, bytes);
+}
+
+// ─────────────────────────────────────────────────────────────
+//                  TUNING
+// ─────────────────────────────────────────────────────────────
+
+/** Number of element widths with a tuned kernel: 16, 32 and 64 bits */
+static const std::size_t TUNE_WIDTHS = 3;
+
+/** Number of size buckets: below 1KiB, then up to 16KiB, 256KiB, 4MiB, 64MiB and above */
+static const std::size_t TUNE_BUCKETS = 6;
+
+/** Flag of a kernel that writes with non-temporal stores, the low bits hold the Simd */
+static const std::uint8_t KERNEL_STREAM = 0x80;
+
+/** Kernel of a width and bucket that isn't tuned: the selected Simd and streaming threshold are used */
+static const std::uint8_t KERNEL_DEFAULT = 0xFF;
+
+/**
+ * \brief Fastest kernel per element width and size bucket, filled by AUTOTUNE or LOAD_TUNING (Tune.hpp).
+ */
+struct tuning_table
+{
+    tuning_table() : configured(false)
+    {
+        for(std::size_t w = 0; w < TUNE_WIDTHS; ++w)
+            for(std::size_t b = 0; b < TUNE_BUCKETS; ++b)
+                kernels[w][b].store(KERNEL_DEFAULT, std::memory_order_relaxed);
+    }
+
+    /** Set once the table was explicitly tuned or reset, so the first use calibration is skipped */
+    std::atomic<bool> configured;
+    std::atomic<std::uint8_t> kernels[TUNE_WIDTHS][TUNE_BUCKETS];
+};
+
+inline tuning_table& tuning_storage()
+{
+    static tuning_table table;
+    return table;
+}
+
+#ifdef ENDN_AUTOTUNE
+/** Calibrate the table unless it is already configured, defined in Tune.hpp */
+inline bool autotune_first_use(tuning_table& table);
+#endif
+
+/**
+ * \brief Kernel table used by the bulk functions. With ENDN_AUTOTUNE it is calibrated on first use.
+ */
+inline tuning_table& tuning()
+{
+#ifdef ENDN_AUTOTUNE
+    static const bool calibrated = autotune_first_use(tuning_storage());
+    (void)calibrated;
+#endif
+    return tuning_storage();
+}
+
+/**
+ * \brief Forget the tuned kernels, the bulk functions use the selected Simd and streaming threshold again.
+ */
+inline void reset_tuning()
+{
+    tuning_table& table = tuning_storage();
+    table.configured.store(true, std::memory_order_relaxed);
+    for(std::size_t w = 0; w < TUNE_WIDTHS; ++w)
+        for(std::size_t b = 0; b < TUNE_BUCKETS; ++b)
+            table.kernels[w][b].store(KERNEL_DEFAULT, std::memory_order_relaxed);
+}
+
+/**
+ * \brief Row of the tuning table of elements of size bytes, TUNE_WIDTHS if the width isn't tuned.
+ */
+inline std::size_t tune_width(const std::size_t size)
+{
+    return size == 2 ? 0 : size == 4 ? 1 : size == 8 ? 2 : TUNE_WIDTHS;
+}
+
+/**
+ * \brief Column of the tuning table of a conversion of bytes. Buckets grow by a factor 16 from 1KiB.
+ */
+inline std::size_t tune_bucket(const std::size_t bytes)
+{
+    std::size_t bucket = 0;
+    for(std::size_t limit = 1024; bucket + 1 < TUNE_BUCKETS && bytes >= limit; limit *= 16)
+        ++bucket;
+    return bucket;
+}
+
+/**
+ * \brief Kernel used to swap bytes of elements of the given size into dest.
+ * The tuned kernel is used when there is one, otherwise the selected Simd and streaming threshold.
+ */
+inline std::uint8_t select_kernel(const std::size_t size, const void* dest, const std::size_t bytes)
+{
+    const std::size_t width = tune_width(size);
+    const std::uint8_t kernel =
+        width < TUNE_WIDTHS ? tuning().kernels[width][tune_bucket(bytes)].load(std::memory_order_relaxed) : KERNEL_DEFAULT;
+    if(kernel == KERNEL_DEFAULT)
+    {
+        const std::uint8_t stream = use_streaming(dest, bytes, size) ? KERNEL_STREAM : 0;
+        return std::uint8_t(simd_selected().load(std::memory_order_relaxed) | stream);
+    }
+    // Non-temporal stores need dest aligned on its element size
+    return std::uintptr_t(dest) % size == 0 ? kernel : std::uint8_t(kernel & ~KERNEL_STREAM);
+}
+
+/**
+ * \brief Byte swap count elements of type T from src to dest with the given kernel.
+ * src and dest must not overlap, unless dest == src.
+ */
+template<typename T>
+inline void swap_kernel(const std::uint8_t kernel, void* dest, const void* src, const std::size_t count)
+{
+#ifdef ENDN_SIMD_X86
+    const bool stream = (kernel & KERNEL_STREAM) != 0;
+#endif
+    switch(Simd(kernel & ~KERNEL_STREAM))
+    {
+#ifdef ENDN_SIMD_X86
+    case Simd::AVX2:
+        if(stream)
+            swap_avx2<T, true>(dest, src, count);
+        else
+            swap_avx2<T, false>(dest, src, count);
+        return;
+    case Simd::SSSE3:
+        if(stream)
+            swap_ssse3<T, true>(dest, src, count);
+        else
+            swap_ssse3<T, false>(dest, src, count);
+        return;
+#endif
+#ifdef ENDN_SIMD_VECTOR
+    case Simd::VECTOR:
+        swap_vector<T>(dest, src, count);
+        return;
+#endif
+    default:
+        swap_scalar<T>(dest, src, count);
+        return;
+    }
+}
+
+/**
+ * \brief Byte swap count elements of type T from src to dest with the tuned or selected kernel.
+ * src and dest can overlap. Above the streaming threshold dest is written with non-temporal stores.
+ */
+template<typename T>
+inline void swap_array(void* dest, const void* src, const std::size_t count)
+{
+    if(dest != src && OVERLAP(std::uintptr_t(dest), std::uintptr_t(src), count * sizeof(T)))
+    {
+        std::memmove(dest, src, count * sizeof(T));
+        src = dest;
+    }
+
+    swap_kernel<T>(select_kernel(sizeof(T), dest, count * sizeof(T)), dest, src, count);
+}
+
+
+/**
+ * \brief Unpack count 3 bytes integers of the given order from src into host std::uint32_t.
+ * When Signed is true the values are sign extended. src and dest must not overlap.
+ */
+template<Order order, bool Signed>
+inline void unpack24(std::uint32_t* dest, const std::uint8_t* src, const std::size_t count)
+{
+    switch(Simd(simd_selected().load(std::memory_order_relaxed)))
+    {
+#ifdef ENDN_SIMD_X86
+    case Simd::AVX2:
+        unpack24_avx2<order, Signed>(dest, src, count);
+        return;
+    case Simd::SSSE3:
+        unpack24_ssse3<order, Signed>(dest, src, count);
+        return;
+#endif
+#ifdef ENDN_SIMD_VECTOR
+    case Simd::VECTOR:
+        unpack24_vector<order, Signed>(dest, src, count);
+        return;
+#endif
+    default:
+        unpack24_scalar<order, Signed>(dest, src, count);
+        return;
+    }
+}
+
+/**
+ * \brief Pack count host std::uint32_t into 3 bytes integers of the given order.
+ * src and dest must not overlap.
+ */
+template<Order order>
+inline void pack24(std::uint8_t* dest, const std::uint32_t* src, const std::size_t count)
+{
+    switch(Simd(simd_selected().load(std::memory_order_relaxed)))
+    {
+#ifdef ENDN_SIMD_X86
+    case Simd::AVX2:
+        pack24_avx2<order>(dest, src, count);
+        return;
+    case Simd::SSSE3:
+        pack24_ssse3<order>(dest, src, count);
+        return;
+#endif
+#ifdef ENDN_SIMD_VECTOR
+    case Simd::VECTOR:
+        pack24_vector<order>(dest, src, count);
+        return;
+#endif
+    default:
+        pack24_scalar<order>(dest, src, count);
+        return;
+    }
+}
+
+/**
+ * \brief Unpack count 6 bytes integers of the given order from src into host std::uint64_t.
+ * When Signed is true the values are sign extended. src and dest must not overlap.
+ */
+template<Order order, bool Signed>
+inline void unpack48(std::uint64_t* dest, const std::uint8_t* src, const std::size_t count)
+{
+    switch(Simd(simd_selected().load(std::memory_order_relaxed)))
+    {
+#ifdef ENDN_SIMD_X86
+    case Simd::AVX2:
+        unpack48_avx2<order, Signed>(dest, src, count);
+        return;
+    case Simd::SSSE3:
+        unpack48_ssse3<order, Signed>(dest, src, count);
+        return;
+#endif
+#ifdef ENDN_SIMD_VECTOR
+    case Simd::VECTOR:
+        unpack48_vector<order, Signed>(dest, src, count);
+        return;
+#endif
+    default:
+        unpack48_scalar<order, Signed>(dest, src, count);
+        return;
+    }
+}
+
+/**
+ * \brief Pack count host std::uint64_t into 6 bytes integers of the given order.
+ * src and dest must not overlap.
+ */
+template<Order order>
+inline void pack48(std::uint8_t* dest, const std::uint64_t* src, const std::size_t count)
+{
+    switch(Simd(simd_selected().load(std::memory_order_relaxed)))
+    {
+#ifdef ENDN_SIMD_X86
+    case Simd::AVX2:
+        pack48_avx2<order>(dest, src, count);
+        return;
+    case Simd::SSSE3:
+        pack48_ssse3<order>(dest, src, count);
+        return;
+#endif
+#ifdef ENDN_SIMD_VECTOR
+    case Simd::VECTOR:
+        pack48_vector<order>(dest, src, count);
+        return;
+#endif
+    default:
+        pack48_scalar<order>(dest, src, count);
+        return;
+    }
+}
+
+/**
+ * \brief Widen count IEEE binary16 of the given order from src into float.
+ * F16C convert 8 values per instruction when AVX2 is selected, the software conversion is used otherwise.
+ */
+template<Order order>
+inline void unpack_float16(float* dest, const std::uint8_t* src, const std::size_t count)
+{
+#ifdef ENDN_SIMD_X86
+    if(Simd(simd_selected().load(std::memory_order_relaxed)) == Simd::AVX2 && (cached_cpu_features() & CPU_F16C) != 0)
+    {
+        unpack_float16_f16c<order>(dest, src, count);
+        return;
+    }
+#endif
+    unpack_float16_scalar<order>(dest, src, count);
+}
+
+/**
+ * \brief Narrow count float into IEEE binary16 of the given order, rounding to nearest even.
+ */
+template<Order order>
+inline void pack_float16(std::uint8_t* dest, const float* src, const std::size_t count)
+{
+#ifdef ENDN_SIMD_X86
+    if(Simd(simd_selected().load(std::memory_order_relaxed)) == Simd::AVX2 && (cached_cpu_features() & CPU_F16C) != 0)
+    {
+        pack_float16_f16c<order>(dest, src, count);
+        return;
+    }
+#endif
+    pack_float16_scalar<order>(dest, src, count);
+}
+
+/**
+ * \brief Widen count bfloat16 of the given order from src into float.
+ */
+template<Order order>
+inline void unpack_bfloat16(float* dest, const std::uint8_t* src, const std::size_t count)
+{
+    switch(Simd(simd_selected().load(std::memory_order_relaxed)))
+    {
+#ifdef ENDN_SIMD_X86
+    case Simd::AVX2:
+        unpack_bfloat16_avx2<order>(dest, src, count);
+        return;
+    case Simd::SSSE3:
+        unpack_bfloat16_ssse3<order>(dest, src, count);
+        return;
+#endif
+#ifdef ENDN_SIMD_VECTOR
+    case Simd::VECTOR:
+        unpack_bfloat16_vector<order>(dest, src, count);
+        return;
+#endif
+    default:
+        unpack_bfloat16_scalar<order>(dest, src, count);
+        return;
+    }
+}
+
+/**
+ * \brief Narrow count float into bfloat16 of the given order, rounding to nearest even.
+ */
+template<Order order>
+inline void pack_bfloat16(std::uint8_t* dest, const float* src, const std::size_t count)
+{
+    switch(Simd(simd_selected().load(std::memory_order_relaxed)))
+    {
+#ifdef ENDN_SIMD_X86
+    case Simd::AVX2:
+        pack_bfloat16_avx2<order>(dest, src, count);
+        return;
+    case Simd::SSSE3:
+        pack_bfloat16_ssse3<order>(dest, src, count);
+        return;
+#endif
+#ifdef ENDN_SIMD_VECTOR
+    case Simd::VECTOR:
+        pack_bfloat16_vector<order>(dest, src, count);
+        return;
+#endif
+    default:
+        pack_bfloat16_scalar<order>(dest, src, count);
+        return;
+    }
+}
+
+/**
+ * \brief Convert count fixed point Format of the given order from src into float or double.
+ * The swap, the sign extension and the scale are done in a single AVX2 pass for 16 and 32 bits signed formats.
+ */
+template<typename Format, Order order, typename T>
+inline void unpack_fixed(T* dest, const std::uint8_t* src, const std::size_t count)
+{
+#ifdef ENDN_SIMD_X86
+    if(Simd(simd_selected().load(std::memory_order_relaxed)) == Simd::AVX2)
+    {
+        unpack_fixed_avx2<Format, order>(dest, src, count, typename Format::type());
+        return;
+    }
+#endif
+    unpack_fixed_scalar<Format, order>(dest, src, count);
+}
+
+/**
+ * \brief Convert count float or double into fixed point Format of the given order, with saturation.
+ */
+template<typename Format, Order order, typename T>
+inline void pack_fixed(std::uint8_t* dest, const T* src, const std::size_t count)
+{
+#ifdef ENDN_SIMD_X86
+    if(Simd(simd_selected().load(std::memory_order_relaxed)) == Simd::AVX2)
+    {
+        pack_fixed_avx2<Format, order>(dest, src, count, typename Format::type());
+        return;
+    }
+#endif
+    pack_fixed_scalar<Format, order>(dest, src, count);
+}
+
+/**
+ * \brief Convert count Wire of the given order from src into host T, widening or narrowing with saturation.
+ * \return Number of values that were saturated
+ */
+template<typename Wire, Order order, typename T>
+inline std::size_t unpack_convert(T* dest, const std::uint8_t* src, const std::size_t count)
+{
+    static_assert(std::is_integral<Wire>::value == std::is_integral<T>::value && std::is_arithmetic<T>::value,
+        "Conversions are between integers or between floating points");
+#ifdef ENDN_SIMD_X86
+    if(Simd(simd_selected().load(std::memory_order_relaxed)) == Simd::AVX2)
+        return unpack_convert_avx2<Wire, order>(dest, src, count, typename conversion<Wire, T>::tag());
+#endif
+    return unpack_convert_scalar<Wire, order>(dest, src, count);
+}
+
+/**
+ * \brief Convert count host T from src into Wire of the given order, widening or narrowing with saturation.
+ * \return Number of values that were saturated
+ */
+template<typename Wire, Order order, typename T>
+inline std::size_t pack_convert(std::uint8_t* dest, const T* src, const std::size_t count)
+{
+    static_assert(std::is_integral<Wire>::value == std::is_integral<T>::value && std::is_arithmetic<T>::value,
+        "Conversions are between integers or between floating points");
+#ifdef ENDN_SIMD_X86
+    if(Simd(simd_selected().load(std::memory_order_relaxed)) == Simd::AVX2)
+        return pack_convert_avx2<Wire, order>(dest, src, count, typename conversion<T, Wire>::tag());
+#endif
+    return pack_convert_scalar<Wire, order>(dest, src, count);
+}
+
+
+/**
+ * \brief Copy count fields of type T at src + offsets[i] into the contiguous dest, in host order.
+ * 16 bits fields have no gather instruction and use the prefetched scalar loop, as do 32 bits targets.
+ */
+template<Order order>
+inline void gather(std::uint16_t* dest, const std::uint8_t* src, const std::size_t* offsets, const std::size_t count)
+{
+    gather_scalar<std::uint16_t, order>(dest, src, offsets, count);
+}
+
+template<Order order>
+inline void gather(std::uint32_t* dest, const std::uint8_t* src, const std::size_t* offsets, const std::size_t count)
+{
+#ifdef ENDN_SIMD_X86
+    if(Simd(simd_selected().load(std::memory_order_relaxed)) == Simd::AVX2 && sizeof(std::size_t) == 8)
+    {
+        gather32_avx2<order>(dest, src, offsets, count);
+        return;
+    }
+#endif
+    gather_scalar<std::uint32_t, order>(dest, src, offsets, count);
+}
+
+template<Order order>
+inline void gather(std::uint64_t* dest, const std::uint8_t* src, const std::size_t* offsets, const std::size_t count)
+{
+#ifdef ENDN_SIMD_X86
+    if(Simd(simd_selected().load(std::memory_order_relaxed)) == Simd::AVX2 && sizeof(std::size_t) == 8)
+    {
+        gather64_avx2<order>(dest, src, offsets, count);
+        return;
+    }
+#endif
+    gather_scalar<std::uint64_t, order>(dest, src, offsets, count);
+}
+
+/**
+ * \brief Stride up to which the AVX2 gather index of a block of 8 records fit in an int.
+ */
+static const std::size_t GATHER_MAX_STRIDE = 0x7FFFFFFF / 8;
+
+/**
+ * \brief Copy count fields of type T spaced by stride bytes from src into the contiguous dest, in host order.
+ * 16 bits fields have no gather instruction and use the scalar loop.
+ */
+template<Order order>
+inline void extract(std::uint16_t* dest, const std::uint8_t* src, const std::size_t stride, const std::size_t count)
+{
+    extract_scalar<std::uint16_t, order>(dest, src, stride, count);
+}
+
+template<Order order>
+inline void extract(std::uint32_t* dest, const std::uint8_t* src, const std::size_t stride, const std::size_t count)
+{
+#ifdef ENDN_SIMD_X86
+    if(Simd(simd_selected().load(std::memory_order_relaxed)) == Simd::AVX2 && stride <= GATHER_MAX_STRIDE)
+    {
+        extract32_avx2<order>(dest, src, stride, count);
+        return;
+    }
+#endif
+    extract_scalar<std::uint32_t, order>(dest, src, stride, count);
+}
+
+template<Order order>
+inline void extract(std::uint64_t* dest, const std::uint8_t* src, const std::size_t stride, const std::size_t count)
+{
+#ifdef ENDN_SIMD_X86
+    if(Simd(simd_selected().load(std::memory_order_relaxed)) == Simd::AVX2 && stride <= GATHER_MAX_STRIDE)
+    {
+        extract64_avx2<order>(dest, src, stride, count);
+        return;
+    }
+#endif
+    extract_scalar<std::uint64_t, order>(dest, src, stride, count);
+}
+
+/**
+ * \brief Copy count 6 bytes fields spaced by stride bytes from src into the contiguous dest, in host order.
+ */
+template<Order order, bool Signed>
+inline void extract48(std::uint64_t* dest, const std::uint8_t* src, const std::size_t stride, const std::size_t count)
+{
+    for(std::size_t i = 0; i < count; ++i, src += stride)
+        unpack48_scalar<order, Signed>(dest + i, src, 1);
+}
+
+
+/**
+ * \brief Number of elements swapped at once in a stack buffer before being scattered.
+ */
+static const std::size_t SCATTER_BLOCK = 64;
+
+/**
+ * \brief Write count host T from src into fields spaced by stride bytes in dest, with the given order.
+ * The swap is vectorized by block of SCATTER_BLOCK elements, then each field is stored.
+ */
+template<typename T, Order order>
+inline void scatter(std::uint8_t* dest, const std::size_t stride, const T* src, const std::size_t count)
+{
+    if(order == HOST_ORDER || sizeof(T) == 1)
+    {
+        for(std::size_t i = 0; i < count; ++i, dest += stride)
+            std::memcpy(dest, src + i, sizeof(T));
+        return;
+    }
+
+    T block[SCATTER_BLOCK];
+    for(std::size_t i = 0; i < count; i += SCATTER_BLOCK)
+    {
+        const std::size_t n = count - i < SCATTER_BLOCK ? count - i : SCATTER_BLOCK;
+        // The block is read back at once, so it is never written with non-temporal stores
+        swap_kernel<T>(std::uint8_t(select_kernel(sizeof(T), block, n * sizeof(T)) & ~KERNEL_STREAM), block, src + i, n);
+        for(std::size_t j = 0; j < n; ++j, dest += stride)
+            std::memcpy(dest, block + j, sizeof(T));
+    }
+}
+
+/**
+ * \brief Write count host std::uint64_t from src as 6 bytes fields spaced by stride bytes in dest.
+ */
+template<Order order>
+inline void scatter48(std::uint8_t* dest, const std::size_t stride, const std::uint64_t* src, const std::size_t count)
+{
+    std::uint8_t block[SCATTER_BLOCK * UINT48_SIZE];
+    for(std::size_t i = 0; i < count; i += SCATTER_BLOCK)
+    {
+        const std::size_t n = count - i < SCATTER_BLOCK ? count - i : SCATTER_BLOCK;
+        pack48<order>(block, src + i, n);
+        for(std::size_t j = 0; j < n; ++j, dest += stride)
+            std::memcpy(dest, block + j * UINT48_SIZE, UINT48_SIZE);
+    }
+}
+
+/**
+ * \brief Scatter count elements of a column, starting at element first of the host array.
+ */
+template<Order order>
+inline void scatter_column(
+    std::uint8_t* dest, const std::size_t stride, const Column& column, const std::size_t first, const std::size_t count)
+{
+    dest += column.offset;
+    switch(column.type)
+    {
+    case Type::UINT8:
+    case Type::INT8:
+        scatter<std::uint8_t, order>(dest, stride, static_cast<const std::uint8_t*>(column.data) + first, count);
+        return;
+    case Type::UINT16:
+    case Type::INT16:
+        scatter<std::uint16_t, order>(dest, stride, static_cast<const std::uint16_t*>(column.data) + first, count);
+        return;
+    case Type::UINT32:
+    case Type::INT32:
+    case Type::FLOAT32:
+        scatter<std::uint32_t, order>(dest, stride, static_cast<const std::uint32_t*>(column.data) + first, count);
+        return;
+    case Type::UINT48:
+    case Type::INT48:
+        scatter48<order>(dest, stride, static_cast<const std::uint64_t*>(column.data) + first, count);
+        return;
+    case Type::UINT64:
+    case Type::INT64:
+    case Type::FLOAT64:
+        scatter<std::uint64_t, order>(dest, stride, static_cast<const std::uint64_t*>(column.data) + first, count);
+        return;
+    }
+}
+
+/**
+ * \brief Fill count records of stride bytes from several columns.
+ * Records are processed by block of SCATTER_BLOCK, so each block is written by every column while it is still in cache.
+ */
+template<Order order>
+inline void scatter_columns(
+    std::uint8_t* dest, const std::size_t stride, const std::size_t count, const Column* columns, const std::size_t columnCount)
+{
+    for(std::size_t i = 0; i < count; i += SCATTER_BLOCK)
+    {
+        const std::size_t n = count - i < SCATTER_BLOCK ? count - i : SCATTER_BLOCK;
+        for(std::size_t c = 0; c < columnCount; ++c)
+            scatter_column<order>(dest + i * stride, stride, columns[c], i, n);
+    }
+}
+
+}
+
+// ─────────────────────────────────────────────────────────────
+//                  API
+// ─────────────────────────────────────────────────────────────
+
+/**
+ * \brief Check if an instruction set can be used on the executing cpu
+ * \param simd Instruction set to check
+ * \return true if the instruction set was compiled in and is supported by the cpu
+ */
+inline bool IS_SIMD_SUPPORTED(const Simd simd)
+{
+    return detail::simd_supported(simd);
+}
+
+/**
+ * \brief Instruction set currently used by the bulk functions
+ * \return The best supported instruction set, unless overridden with SET_SIMD
+ */
+inline Simd GET_SIMD()
+{
+    return Simd(detail::simd_selected().load(std::memory_order_relaxed));
+}
+
+/**
+ * \brief Force the instruction set used by the bulk functions (benchmark, tests)
+ * \param simd Instruction set to use
+ * \return false if the instruction set isn't supported, in that case the selection is unchanged
+ * \note The kernels tuned by AUTOTUNE or LOAD_TUNING (Tune.hpp) are discarded
+ */
+inline bool SET_SIMD(const Simd simd)
+{
+    if(!IS_SIMD_SUPPORTED(simd))
+        return false;
+    detail::reset_tuning();
+    detail::simd_selected().store(std::uint8_t(simd), std::memory_order_relaxed);
+    return true;
+}
+
+/**
+ * \brief Size from which bulk conversions bypass the cache with non-temporal stores
+ * \return ENDN_STREAMING_THRESHOLD (32MiB), unless overridden with SET_STREAMING_THRESHOLD
+ */
+inline std::size_t GET_STREAMING_THRESHOLD()
+{
+    return detail::streaming_threshold().load(std::memory_order_relaxed);
+}
+
+/**
+ * \brief Set the size from which MEMCPY_*, SET_ARRAY_* and SWAP_INPLACE_* write with non-temporal stores.
+ * Use it for buffers much bigger than the last level cache that won't be read soon, to avoid evicting the working set.
+ * \param bytes Size of the destination in bytes, STREAMING_ALWAYS or STREAMING_NEVER
+ * \note Only the 16, 32 and 64 bits conversions stream, and only with a SIMD instruction set selected.
+ * The kernels tuned by AUTOTUNE or LOAD_TUNING (Tune.hpp) are discarded.
+ */
+inline void SET_STREAMING_THRESHOLD(const std::size_t bytes)
+{
+    detail::reset_tuning();
+    detail::streaming_threshold().store(bytes, std::memory_order_relaxed);
+}
+
+}
+
+// The first use calibration is defined with the tuning API
+#ifdef ENDN_AUTOTUNE
+#    include <Endn/Tune.hpp>
+#endif
+
+#endif
@@ -0,0 +1,355 @@
+/**
+ * \file Tune.hpp
+ * \brief Calibration of the bulk swap kernels per element width and size
+ */
+#ifndef __ENDN_TUNE_HPP__
+#define __ENDN_TUNE_HPP__
+
+// ─────────────────────────────────────────────────────────────
+//                  INCLUDE
+// ─────────────────────────────────────────────────────────────
+
+// Library Headers
+#include <Endn/Simd.hpp>
+
+// C++ Headers
+#include <chrono>
+#include <cstdint>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+/** Largest conversion (in bytes) timed by AUTOTUNE, the buckets above reuse its result */
+#ifndef ENDN_TUNE_MAX_BYTES
+#    define ENDN_TUNE_MAX_BYTES (std::size_t(16) << 20)
+#endif
+
+// ─────────────────────────────────────────────────────────────
+//                  DECLARATION
+// ─────────────────────────────────────────────────────────────
+
+namespace endn {
+
+/**
+ * \brief Kernel used by MEMCPY_*, SET_ARRAY_* and SWAP_INPLACE_* for a conversion
+ */
+struct Kernel
+{
+    Simd simd;
+    /** Write with non-temporal stores */
+    bool streaming;
+};
+
+namespace detail {
+
+/** First line of a tuning file, followed by the file version and the cpu features */
+static const char TUNING_MAGIC[] = "endn-tuning";
+static const int TUNING_VERSION = 1;
+
+/** Number of times each kernel is timed, the fastest run is kept */
+static const int TUNE_RUNS = 3;
+
+/** Minimum number of bytes converted by a timed run, small sizes are repeated */
+static const std::size_t TUNE_RUN_BYTES = std::size_t(256) << 10;
+
+/**
+ * \brief Features of the cpu a table is tuned for. A tuning file is only loaded on the same cpu features.
+ */
+inline unsigned tuning_cpu()
+{
+#ifdef ENDN_SIMD_X86
+    return cached_cpu_features();
+#else
+    return 0;
+#endif
+}
+
+/**
+ * \brief Size timed for a bucket: the geometric middle of the bucket (256B, 4KiB, 64KiB, 1MiB, 16MiB, 256MiB).
+ */
+inline std::size_t tune_bucket_bytes(const std::size_t bucket)
+{
+    return std::size_t(256) << (4 * bucket);
+}
+
+/**
+ * \brief Fill kernels with every kernel supported by the cpu, return their number.
+ */
+inline std::size_t candidate_kernels(std::uint8_t* kernels)
+{
+    static const Simd simds[] = {Simd::SCALAR, Simd::SSSE3, Simd::AVX2, Simd::VECTOR};
+    std::size_t count = 0;
+    for(const Simd simd: simds)
+    {
+        if(!simd_supported(simd))
+            continue;
+        kernels[count++] = std::uint8_t(simd);
+        if(simd == Simd::SSSE3 || simd == Simd::AVX2)
+            kernels[count++] = std::uint8_t(std::uint8_t(simd) | KERNEL_STREAM);
+    }
+    return count;
+}
+
+/**
+ * \brief Time the fastest of TUNE_RUNS runs of kernel on count elements, in seconds per element.
+ */
+template<typename T>
+inline double time_kernel(const std::uint8_t kernel, void* dest, const void* src, const std::size_t count)
+{
+    const std::size_t repeat = count * sizeof(T) < TUNE_RUN_BYTES ? TUNE_RUN_BYTES / (count * sizeof(T)) : 1;
+    double best = 0;
+    for(int run = 0; run < TUNE_RUNS; ++run)
+    {
+        const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        for(std::size_t i = 0; i < repeat; ++i)
+            swap_kernel<T>(kernel, dest, src, count);
+        const double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        if(run == 0 || elapsed < best)
+            best = elapsed;
+    }
+    return best / double(repeat * count);
+}
+
+/**
+ * \brief Store the fastest kernel of each size bucket of T in kernels.
+ * dest and src hold at least maxBytes. Buckets bigger than maxBytes are timed at maxBytes.
+ */
+template<typename T>
+inline void autotune_width(std::atomic<std::uint8_t>* kernels, void* dest, const void* src, const std::size_t maxBytes)
+{
+    std::uint8_t candidates[8];
+    const std::size_t candidateCount = candidate_kernels(candidates);
+
+    std::size_t previousCount = 0;
+    std::uint8_t best = KERNEL_DEFAULT;
+    for(std::size_t bucket = 0; bucket < TUNE_BUCKETS; ++bucket)
+    {
+        const std::size_t bytes = tune_bucket_bytes(bucket) < maxBytes ? tune_bucket_bytes(bucket) : maxBytes;
+        const std::size_t count = bytes / sizeof(T) ? bytes / sizeof(T) : 1;
+        if(count != previousCount)
+        {
+            double bestTime = 0;
+            for(std::size_t c = 0; c < candidateCount; ++c)
+            {
+                const double time = time_kernel<T>(candidates[c], dest, src, count);
+                if(c == 0 || time < bestTime)
+                {
+                    bestTime = time;
+                    best = candidates[c];
+                }
+            }
+            previousCount = count;
+        }
+        kernels[bucket].store(best, std::memory_order_relaxed);
+    }
+}
+
+/**
+ * \brief Time every kernel of every width and size bucket and fill the table with the fastest ones.
+ */
+inline void autotune(tuning_table& table, std::size_t maxBytes)
+{
+    maxBytes = maxBytes < sizeof(std::uint64_t) ? sizeof(std::uint64_t) : maxBytes;
+    // Aligned on 8 so the streaming kernels are timed on their aligned path
+    std::vector<std::uint64_t> src(maxBytes / sizeof(std::uint64_t) + 1, 0x0123456789ABCDEF);
+    std::vector<std::uint64_t> dest(src.size(), 0);
+
+    table.configured.store(true, std::memory_order_relaxed);
+    autotune_width<std::uint16_t>(table.kernels[0], dest.data(), src.data(), maxBytes);
+    autotune_width<std::uint32_t>(table.kernels[1], dest.data(), src.data(), maxBytes);
+    autotune_width<std::uint64_t>(table.kernels[2], dest.data(), src.data(), maxBytes);
+}
+
+/**
+ * \brief Name of a kernel in a tuning file.
+ */
+inline const char* kernel_name(const std::uint8_t kernel)
+{
+    switch(kernel)
+    {
+    case std::uint8_t(Simd::SCALAR):
+        return "SCALAR";
+    case std::uint8_t(Simd::SSSE3):
+        return "SSSE3";
+    case std::uint8_t(Simd::SSSE3) | KERNEL_STREAM:
+        return "SSSE3+STREAM";
+    case std::uint8_t(Simd::AVX2):
+        return "AVX2";
+    case std::uint8_t(Simd::AVX2) | KERNEL_STREAM:
+        return "AVX2+STREAM";
+    case std::uint8_t(Simd::VECTOR):
+        return "VECTOR";
+    default:
+        return "DEFAULT";
+    }
+}
+
+/**
+ * \brief Parse a kernel written by kernel_name. Return false if the name is unknown or the cpu doesn't support it.
+ */
+inline bool parse_kernel(const char* name, std::uint8_t& kernel)
+{
+    static const std::uint8_t kernels[] = {std::uint8_t(Simd::SCALAR), std::uint8_t(Simd::SSSE3),
+        std::uint8_t(std::uint8_t(Simd::SSSE3) | KERNEL_STREAM), std::uint8_t(Simd::AVX2),
+        std::uint8_t(std::uint8_t(Simd::AVX2) | KERNEL_STREAM), std::uint8_t(Simd::VECTOR), KERNEL_DEFAULT};
+    for(const std::uint8_t k: kernels)
+    {
+        if(std::strcmp(name, kernel_name(k)) != 0)
+            continue;
+        if(k != KERNEL_DEFAULT && !simd_supported(Simd(k & ~KERNEL_STREAM)))
+            return false;
+        kernel = k;
+        return true;
+    }
+    return false;
+}
+
+/**
+ * \brief Write table to path, see SAVE_TUNING.
+ */
+inline bool save_tuning(const tuning_table& table, const char* path)
+{
+    std::FILE* file = std::fopen(path, "w");
+    if(!file)
+        return false;
+
+    bool ok = std::fprintf(file, "%s %d %u\n", TUNING_MAGIC, TUNING_VERSION, tuning_cpu()) > 0;
+    for(std::size_t w = 0; w < TUNE_WIDTHS; ++w)
+    {
+        ok = ok && std::fprintf(file, "%u", unsigned(16) << w) > 0;
+        for(std::size_t b = 0; b < TUNE_BUCKETS; ++b)
+            ok = ok && std::fprintf(file, " %s", kernel_name(table.kernels[w][b].load(std::memory_order_relaxed))) > 0;
+        ok = ok && std::fprintf(file, "\n") > 0;
+    }
+    return std::fclose(file) == 0 && ok;
+}
+
+}
+
+// ─────────────────────────────────────────────────────────────
+//                  API
+// ─────────────────────────────────────────────────────────────
+
+/**
+ * \brief Time every kernel supported by the cpu and use the fastest one per element width and size bucket.
+ * Each of the 16, 32 and 64 bits conversions have 6 size buckets: below 1KiB, then up to 16KiB, 256KiB, 4MiB, 64MiB
+ * and above. The calibration takes a few hundred milliseconds with the default maxBytes.
+ * \param maxBytes Largest conversion timed, the buckets above reuse its result
+ * \note SET_SIMD and SET_STREAMING_THRESHOLD discard the tuned kernels
+ */
+inline void AUTOTUNE(const std::size_t maxBytes = ENDN_TUNE_MAX_BYTES)
+{
+    detail::autotune(detail::tuning_storage(), maxBytes);
+}
+
+/**
+ * \brief Forget the tuned kernels. The bulk functions use GET_SIMD and GET_STREAMING_THRESHOLD again.
+ */
+inline void RESET_TUNING()
+{
+    detail::reset_tuning();
+}
+
+/**
+ * \brief Check if the bulk functions use tuned kernels
+ */
+inline bool IS_TUNED()
+{
+    const detail::tuning_table& table = detail::tuning();
+    for(std::size_t w = 0; w < detail::TUNE_WIDTHS; ++w)
+        for(std::size_t b = 0; b < detail::TUNE_BUCKETS; ++b)
+            if(table.kernels[w][b].load(std::memory_order_relaxed) != detail::KERNEL_DEFAULT)
+                return true;
+    return false;
+}
+
+/**
+ * \brief Kernel used to convert bytes of elements of elementSize bytes into an aligned destination
+ * \param elementSize Size of an element. Only 2, 4 and 8 are tuned
+ * \param bytes Size of the conversion
+ */
+inline Kernel GET_KERNEL(const std::size_t elementSize, const std::size_t bytes)
+{
+    static const std::uint64_t aligned = 0;
+    const std::uint8_t kernel = detail::select_kernel(elementSize ? elementSize : 1, &aligned, bytes);
+    const Kernel result = {Simd(kernel & ~detail::KERNEL_STREAM), (kernel & detail::KERNEL_STREAM) != 0};
+    return result;
+}
+
+/**
+ * \brief Write the tuned kernels to a text file, to be loaded by LOAD_TUNING on a machine with the same cpu
+ * \param path Path of the file
+ * \return false if the file can't be written
+ */
+inline bool SAVE_TUNING(const char* path)
+{
+    return detail::save_tuning(detail::tuning(), path);
+}
+
+/**
+ * \brief Use the kernels of a file written by SAVE_TUNING
+ * \param path Path of the file
+ * \return false if the file can't be read, is malformed, or was tuned on a cpu with other features.
+ * In that case the current kernels are unchanged
+ */
+inline bool LOAD_TUNING(const char* path)
+{
+    std::FILE* file = std::fopen(path, "r");
+    if(!file)
+        return false;
+
+    std::uint8_t kernels[detail::TUNE_WIDTHS][detail::TUNE_BUCKETS];
+    char name[32];
+    int version = 0;
+    unsigned cpu = 0;
+    bool ok = std::fscanf(file, "%31s %d %u", name, &version, &cpu) == 3 && std::strcmp(name, detail::TUNING_MAGIC) == 0 &&
+              version == detail::TUNING_VERSION && cpu == detail::tuning_cpu();
+    for(std::size_t w = 0; ok && w < detail::TUNE_WIDTHS; ++w)
+    {
+        unsigned bits = 0;
+        ok = std::fscanf(file, "%u", &bits) == 1 && bits == unsigned(16) << w;
+        for(std::size_t b = 0; ok && b < detail::TUNE_BUCKETS; ++b)
+            ok = std::fscanf(file, "%31s", name) == 1 && detail::parse_kernel(name, kernels[w][b]);
+    }
+    std::fclose(file);
+    if(!ok)
+        return false;
+
+    detail::tuning_table& table = detail::tuning_storage();
+    table.configured.store(true, std::memory_order_relaxed);
+    for(std::size_t w = 0; w < detail::TUNE_WIDTHS; ++w)
+        for(std::size_t b = 0; b < detail::TUNE_BUCKETS; ++b)
+            table.kernels[w][b].store(kernels[w][b], std::memory_order_relaxed);
+    return true;
+}
+
+#ifdef ENDN_AUTOTUNE
+namespace detail {
+
+/**
+ * \brief Tune the table on first use of a bulk function.
+ * When the ENDN_TUNING_FILE environment variable is set the table is loaded from that file,
+ * or tuned and saved to it if it can't be loaded.
+ */
+inline bool autotune_first_use(tuning_table& table)
+{
+    if(table.configured.load(std::memory_order_relaxed))
+        return false;
+
+    const char* path = std::getenv("ENDN_TUNING_FILE");
+    if(path && *path && LOAD_TUNING(path))
+        return true;
+    autotune(table, ENDN_TUNE_MAX_BYTES);
+    if(path && *path)
+        save_tuning(table, path);
+    return true;
+}
+
+}
+#endif
+
+}
+
+#endif
@@ -0,0 +1,434 @@
+/**
+ * \file Writer.hpp
+ * \brief Growable serialization buffer, with an inline small buffer and chained typed writes
+ */
+#ifndef __ENDN_WRITER_HPP__
+#define __ENDN_WRITER_HPP__
+
+// ─────────────────────────────────────────────────────────────
+//                  INCLUDE
+// ─────────────────────────────────────────────────────────────
+
+// Library Headers
+#include <Endn/Endn.hpp>
+#include <Endn/Core.hpp>
+
+// C++ Headers
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+
+/** Size of the buffer embedded in a Writer (in bytes), smaller messages never allocate */
+#ifndef ENDN_WRITER_INLINE_SIZE
+#    define ENDN_WRITER_INLINE_SIZE 256
+#endif
+
+// ─────────────────────────────────────────────────────────────
+//                  DECLARATION
+// ─────────────────────────────────────────────────────────────
+
+namespace endn {
+
+template<Order order, std::size_t Inline, typename Allocator>
+class Writer;
+
+/**
+ * \brief Bytes allocated with Allocator, handed off by Writer::release(). Move only.
+ */
+template<typename Allocator = std::allocator<std::uint8_t>>
+class Buffer
+{
+    typedef std::allocator_traits<Allocator> traits;
+
+public:
+    explicit Buffer(const Allocator& allocator = Allocator()) : _allocator(allocator) {}
+
+    Buffer(Buffer&& other) :
+        _allocator(std::move(other._allocator)), _data(other._data), _size(other._size), _capacity(other._capacity)
+    {
+        other._data = nullptr;
+        other._size = 0;
+        other._capacity = 0;
+    }
+
+    Buffer& operator=(Buffer&& other)
+    {
+        if(this != &other)
+        {
+            reset();
+            _allocator = std::move(other._allocator);
+            _data = other._data;
+            _size = other._size;
+            _capacity = other._capacity;
+            other._data = nullptr;
+            other._size = 0;
+            other._capacity = 0;
+        }
+        return *this;
+    }
+
+    Buffer(const Buffer&) = delete;
+    Buffer& operator=(const Buffer&) = delete;
+
+    ~Buffer()
+    {
+        reset();
+    }
+
+    const std::uint8_t* data() const
+    {
+        return _data;
+    }
+
+    std::uint8_t* data()
+    {
+        return _data;
+    }
+
+    std::size_t size() const
+    {
+        return _size;
+    }
+
+    std::size_t capacity() const
+    {
+        return _capacity;
+    }
+
+    bool empty() const
+    {
+        return _size == 0;
+    }
+
+    /**
+     * \brief Free the bytes
+     */
+    void reset()
+    {
+        if(_data)
+            traits::deallocate(_allocator, _data, _capacity);
+        _data = nullptr;
+        _size = 0;
+        _capacity = 0;
+    }
+
+private:
+    template<Order, std::size_t, typename>
+    friend class Writer;
+
+    Allocator _allocator;
+    std::uint8_t* _data = nullptr;
+    std::size_t _size = 0;
+    std::size_t _capacity = 0;
+};
+
+/**
+ * \brief Append typed fields of the given order to a growable buffer.
+ *
+ * The first Inline bytes are written in the Writer itself, then the storage double on the heap through Allocator.
+ * reserve(n) is the only capacity check: the next n bytes can then be written with the unchecked
+ * uint8() ... float64(), that return the Writer to chain them. write(value) grow as needed for a single field.
+ *
+ * \code
+ * endn::big::Writer writer;
+ * writer.reserve(12).uint32(id).float64(value);
+ * send(writer.data(), writer.size());
+ * \endcode
+ *
+ * Send small messages from data() and size(): release() copies inline bytes in a new allocation.
+ */
+template<Order order, std::size_t Inline = ENDN_WRITER_INLINE_SIZE, typename Allocator = std::allocator<std::uint8_t>>
+class Writer
+{
+    static_assert(std::is_same<typename Allocator::value_type, std::uint8_t>::value, "Writer allocate std::uint8_t");
+    static_assert(Inline > 0, "Writer need an inline buffer");
+
+    typedef std::allocator_traits<Allocator> traits;
+
+public:
+    explicit Writer(const Allocator& allocator = Allocator()) : _allocator(allocator) {}
+
+    /**
+     * \brief Take the heap storage of other, or copy its inline bytes. other is left empty.
+     */
+    Writer(Writer&& other) : _allocator(std::move(other._allocator)), _size(other._size)
+    {
+        if(other.isInline())
+            std::memcpy(_inline, other._inline, other._size);
+        else
+        {
+            _data = other._data;
+            _capacity = other._capacity;
+            other._data = other._inline;
+            other._capacity = Inline;
+        }
+        other._size = 0;
+    }
+
+    Writer(const Writer&) = delete;
+    Writer& operator=(const Writer&) = delete;
+    Writer& operator=(Writer&&) = delete;
+
+    ~Writer()
+    {
+        if(!isInline())
+            traits::deallocate(_allocator, _data, _capacity);
+    }
+
+    // ───── Storage
+
+    const std::uint8_t* data() const
+    {
+        return _data;
+    }
+
+    /**
+     * \brief Number of bytes written
+     */
+    std::size_t size() const
+    {
+        return _size;
+    }
+
+    /**
+     * \brief Number of bytes that can be written before the next allocation
+     */
+    std::size_t capacity() const
+    {
+        return _capacity;
+    }
+
+    /**
+     * \brief true while the bytes are still in the inline buffer
+     */
+    bool isInline() const
+    {
+        return _data == _inline;
+    }
+
+    /**
+     * \brief Forget the bytes written, keep the storage
+     */
+    void clear()
+    {
+        _size = 0;
+    }
+
+    /**
+     * \brief Make room for n more bytes, that can then be written unchecked
+     */
+    Writer& reserve(const std::size_t n)
+    {
+        if(n > _capacity - _size)
+            grow(n);
+        return *this;
+    }
+
+    /**
+     * \brief Hand off the bytes written. The heap storage is moved without copy, but inline bytes are always copied
+     * in a new allocation of size() bytes: data() and size() are the path that never allocate for small messages.
+     * The Writer is left empty, back on its inline buffer.
+     */
+    Buffer<Allocator> release()
+    {
+        Buffer<Allocator> buffer(_allocator);
+        if(isInline())
+        {
+            if(_size)
+            {
+                buffer._data = traits::allocate(buffer._allocator, _size);
+                buffer._capacity = _size;
+                std::memcpy(buffer._data, _inline, _size);
+            }
+        }
+        else
+        {
+            buffer._data = _data;
+            buffer._capacity = _capacity;
+            _data = _inline;
+            _capacity = Inline;
+        }
+        buffer._size = _size;
+        _size = 0;
+        return buffer;
+    }
+
+    // ───── Unchecked writes, inside room made by reserve
+
+    Writer& bytes(const void* src, const std::size_t n)
+    {
+        if(n)
+            std::memcpy(_data + _size, src, n);
+        _size += n;
+        return *this;
+    }
+
+    Writer& uint8(const std::uint8_t val)
+    {
+        return put<std::uint8_t>(val);
+    }
+
+    Writer& int8(const int8_t val)
+    {
+        return put<int8_t>(val);
+    }
+
+    Writer& uint16(const std::uint16_t val)
+    {
+        return put<std::uint16_t>(val);
+    }
+
+    Writer& int16(const int16_t val)
+    {
+        return put<int16_t>(val);
+    }
+
+    Writer& uint24(const std::uint32_t val)
+    {
+        return put<std::uint32_t, UINT24_SIZE>(val);
+    }
+
+    Writer& int24(const int32_t val)
+    {
+        return put<int32_t, INT24_SIZE>(val);
+    }
+
+    Writer& uint32(const std::uint32_t val)
+    {
+        return put<std::uint32_t>(val);
+    }
+
+    Writer& int32(const int32_t val)
+    {
+        return put<int32_t>(val);
+    }
+
+    Writer& uint48(const std::uint64_t val)
+    {
+        return put<std::uint64_t, UINT48_SIZE>(val);
+    }
+
+    Writer& int48(const int64_t val)
+    {
+        return put<int64_t, INT48_SIZE>(val);
+    }
+
+    Writer& uint64(const std::uint64_t val)
+    {
+        return put<std::uint64_t>(val);
+    }
+
+    Writer& int64(const int64_t val)
+    {
+        return put<int64_t>(val);
+    }
+
+    Writer& uint128(const uint128_t val)
+    {
+        store_uint128<order>(_data, _size, val);
+        _size += UINT128_SIZE;
+        return *this;
+    }
+
+    Writer& float16(const float val)
+    {
+        store_float16<order>(_data, _size, val);
+        _size += FLOAT16_SIZE;
+        return *this;
+    }
+
+    Writer& bfloat16(const float val)
+    {
+        store_bfloat16<order>(_data, _size, val);
+        _size += BFLOAT16_SIZE;
+        return *this;
+    }
+
+    Writer& float32(const float val)
+    {
+        return put<float>(val);
+    }
+
+    Writer& float64(const double val)
+    {
+        return put<double>(val);
+    }
+
+    /**
+     * \brief Write val as fixed point Format, saturated to the Format range (NaN give 0)
+     */
+    template<typename Format, typename T>
+    Writer& fixed(const T val)
+    {
+        store_fixed<Format, order>(_data, _size, val);
+        _size += sizeof(typename Format::type);
+        return *this;
+    }
+
+    /**
+     * \brief Write val on Size bytes (Size < sizeof(T) for the 24 and 48 bits integers)
+     */
+    template<typename T, std::size_t Size = sizeof(T)>
+    Writer& put(const T val)
+    {
+        store<T, order, Size>(_data, _size, val);
+        _size += Size;
+        return *this;
+    }
+
+    // ───── Checked writes
+
+    /**
+     * \brief Write a single field, growing the storage when needed
+     */
+    template<typename T>
+    Writer& write(const T val)
+    {
+        static_assert(std::is_arithmetic<T>::value && !std::is_same<T, bool>::value, "write(value) is for integers and floating points");
+        return reserve(sizeof(T)).template put<T>(val);
+    }
+
+    /**
+     * \brief Copy n bytes, growing the storage when needed
+     */
+    Writer& write(const void* src, const std::size_t n)
+    {
+        return reserve(n).bytes(src, n);
+    }
+
+private:
+    /**
+     * \brief Move to a heap storage of at least _size + n bytes, doubling the capacity
+     */
+    void grow(const std::size_t n)
+    {
+        const std::size_t capacity = _size + n > 2 * _capacity ? _size + n : 2 * _capacity;
+        std::uint8_t* data = traits::allocate(_allocator, capacity);
+        std::memcpy(data, _data, _size);
+        if(!isInline())
+            traits::deallocate(_allocator, _data, _capacity);
+        _data = data;
+        _capacity = capacity;
+    }
+
+private:
+    Allocator _allocator;
+    std::uint8_t* _data = _inline;
+    std::size_t _size = 0;
+    std::size_t _capacity = Inline;
+    std::uint8_t _inline[Inline];
+};
+
+namespace little {
+typedef endn::Writer<Order::LITTLE> Writer;
+}
+
+namespace big {
+typedef endn::Writer<Order::BIG> Writer;
+}
+
+}
+
+#endif
@@ -0,0 +1,80 @@
+#include <Endn/Little.hpp>
+#include <Endn/Big.hpp>
+#include <gtest/gtest.h>
+
+#include <array>
+
+#ifdef ENDN_HAS_CONSTEXPR
+
+namespace {
+
+constexpr std::uint8_t HEADER[] = {0xCA, 0xFE, 0xBA, 0xBE, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x3F, 0xF0, 0, 0, 0, 0, 0, 0};
+
+constexpr std::array<std::uint8_t, 18> makeHeader()
+{
+    std::array<std::uint8_t, 18> buffer {};
+    std::size_t length = 0;
+    endn::big::SET_UINT32(buffer.data(), length, 0xCAFEBABE, length);
+    endn::big::SET_UINT48(buffer.data(), length, 0x000102030405, length);
+    endn::big::SET_FLOAT64(buffer.data(), length, 1.0, length);
+    return buffer;
+}
+
+constexpr std::array<std::uint8_t, 14> makeLittle()
+{
+    std::array<std::uint8_t, 14> buffer {};
+    endn::little::SET_INT16(buffer.data(), 0, -2);
+    endn::little::SET_UINT32(buffer.data(), 2, 0x12345678);
+    endn::little::SET_INT64(buffer.data(), 6, -3);
+    return buffer;
+}
+
+constexpr auto BUILT_HEADER = makeHeader();
+constexpr auto BUILT_LITTLE = makeLittle();
+
+}
+
+static_assert(endn::big::GET_UINT32(HEADER) == 0xCAFEBABE, "constexpr GET_UINT32");
+static_assert(endn::little::GET_UINT32(HEADER) == 0xBEBAFECA, "constexpr GET_UINT32");
+static_assert(endn::big::GET_UINT16(HEADER, 2) == 0xBABE, "constexpr GET_UINT16");
+static_assert(endn::big::GET_UINT48(HEADER, 4) == 0x000102030405, "constexpr GET_UINT48");
+static_assert(endn::little::GET_UINT48(HEADER, 4) == 0x050403020100, "constexpr GET_UINT48");
+static_assert(endn::big::GET_INT48(HEADER) == -0x35014541FFFF, "constexpr GET_INT48");
+static_assert(endn::big::GET_INT24(HEADER) == -0x350146, "constexpr GET_INT24");
+static_assert(endn::big::GET_INT48_PADDED(HEADER, 4) == 0x000102030405, "constexpr GET_INT48_PADDED");
+static_assert(endn::little::GET_INTN(HEADER, 1, 3) == -0x414502, "constexpr GET_INTN");
+static_assert(endn::big::GET_FLOAT64(HEADER, 10) == 1.0, "constexpr GET_FLOAT64");
+static_assert(endn::big::GET_FLOAT16(HEADER, 10) == 1.984375f, "constexpr GET_FLOAT16");
+static_assert(endn::big::GET_BFLOAT16(HEADER, 10) == 1.875f, "constexpr GET_BFLOAT16");
+static_assert(endn::big::GET_FIXED<endn::Q15>(HEADER, 10) == 0.49951171875, "constexpr GET_FIXED");
+static_assert(endn::big::GET_UINT64(BUILT_HEADER.data(), 10) == 0x3FF0000000000000, "constexpr GET_UINT64");
+static_assert(endn::UINT128_HIGH(endn::big::GET_UINT128(HEADER)) == 0xCAFEBABE00010203, "constexpr GET_UINT128");
+static_assert(endn::UINT128_LOW(endn::little::GET_UINT128(HEADER, 2)) == 0x050403020100BEBA, "constexpr GET_UINT128");
+static_assert(BUILT_HEADER[3] == 0xBE && BUILT_HEADER[9] == 0x05, "constexpr SET");
+static_assert(endn::little::GET_INT16(BUILT_LITTLE.data()) == -2, "constexpr GET_INT16");
+static_assert(endn::little::GET_UINT32(BUILT_LITTLE.data(), 2) == 0x12345678, "constexpr GET_UINT32");
+static_assert(endn::little::GET_INT64(BUILT_LITTLE.data(), 6) == -3, "constexpr GET_INT64");
+
+TEST(Constexpr, MatchRuntime)
+{
+    ASSERT_EQ(0, std::memcmp(BUILT_HEADER.data(), HEADER, sizeof(HEADER)));
+
+    std::array<std::uint8_t, 14> little {};
+    endn::little::SET_INT16(little.data(), 0, -2);
+    endn::little::SET_UINT32(little.data(), 2, 0x12345678);
+    endn::little::SET_INT64(little.data(), 6, -3);
+    ASSERT_EQ(little, BUILT_LITTLE);
+}
+
+#endif
+
+TEST(Constexpr, HostOrder)
+{
+#ifdef ENDN_HAS_CONSTEXPR
+    ASSERT_EQ(endn::HOST_ORDER == endn::Order::BIG, std::endian::native == std::endian::big);
+#endif
+    const std::uint16_t value = 0x0102;
+    std::uint8_t bytes[2];
+    std::memcpy(bytes, &value, sizeof(value));
+    ASSERT_EQ(bytes[0], endn::HOST_ORDER == endn::Order::BIG ? 0x01 : 0x02);
+}
@@ -0,0 +1,158 @@
+#include <Endn/Core.hpp>
+#include <gtest/gtest.h>
+#include <gmock/gmock-matchers.h>
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+using endn::Order;
+
+namespace {
+
+std::uint32_t floatBits(const float value)
+{
+    std::uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+// binary16 value from its definition
+float halfValue(const std::uint16_t half)
+{
+    const int exponent = (half >> 10) & 0x1F;
+    const int mantissa = half & 0x3FF;
+    float magnitude = std::ldexp(float(1024 + mantissa), exponent - 25);
+    if(exponent == 0)
+        magnitude = std::ldexp(float(mantissa), -24);
+    else if(exponent == 31)
+        magnitude = mantissa ? std::numeric_limits<float>::quiet_NaN() : std::numeric_limits<float>::infinity();
+    return half & 0x8000 ? -magnitude : magnitude;
+}
+
+// Schema driven decoding, as generic code would use the core
+template<typename T, Order order>
+T roundTrip(const T value)
+{
+    std::uint8_t buffer[sizeof(T) + 1] = {};
+    endn::store<T, order>(buffer, 1, value);
+    return endn::load<T, order>(buffer, 1);
+}
+
+}
+
+TEST(Core, Load)
+{
+    const std::uint8_t buffer[] = {0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09};
+    ASSERT_EQ((endn::load<std::uint16_t, Order::BIG>(buffer)), 0x0102);
+    ASSERT_EQ((endn::load<std::uint16_t, Order::LITTLE>(buffer, 1)), 0x0302);
+    ASSERT_EQ((endn::load<std::uint32_t, Order::BIG>(buffer, 1)), 0x02030405u);
+    ASSERT_EQ((endn::load<std::uint64_t, Order::LITTLE>(buffer, 1)), 0x0908070605040302ull);
+    ASSERT_EQ((endn::load<std::uint64_t, Order::BIG, 6>(buffer, 3)), 0x040506070809ull);
+    ASSERT_EQ((endn::load<std::uint64_t, Order::LITTLE, 6>(buffer, 3)), 0x090807060504ull);
+
+    const char* chars = reinterpret_cast<const char*>(buffer);
+    ASSERT_EQ((endn::load<std::uint32_t, Order::BIG>(chars, 5)), 0x06070809u);
+}
+
+TEST(Core, LoadPadded)
+{
+    const std::uint8_t buffer[] = {0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0xFF, 0xFF, 0xFF};
+    for(std::size_t offset = 0; offset < 4; ++offset)
+    {
+        ASSERT_EQ((endn::load_padded<std::uint64_t, Order::BIG, 6>(buffer, offset)),
+            (endn::load<std::uint64_t, Order::BIG, 6>(buffer, offset)));
+        ASSERT_EQ((endn::load_padded<std::uint64_t, Order::LITTLE, 5>(buffer, offset)),
+            (endn::load<std::uint64_t, Order::LITTLE, 5>(buffer, offset)));
+        ASSERT_EQ((endn::load_padded<std::uint32_t, Order::BIG, 3>(buffer, offset)),
+            (endn::load<std::uint32_t, Order::BIG, 3>(buffer, offset)));
+        ASSERT_EQ((endn::load_padded<std::uint16_t, Order::LITTLE>(buffer, offset)),
+            (endn::load<std::uint16_t, Order::LITTLE>(buffer, offset)));
+    }
+    ASSERT_EQ((endn::load_padded<int64_t, Order::BIG, 7>(buffer, 3)), 0x040506070809FF);
+    ASSERT_EQ((endn::load_padded<int32_t, Order::LITTLE, 3>(buffer, 8)), -0xF7);
+}
+
+TEST(Core, SignExtend)
+{
+    const std::uint8_t buffer[] = {0xFF, 0xFE, 0x80, 0x00, 0x00, 0x01};
+    ASSERT_EQ((endn::load<int16_t, Order::BIG>(buffer)), -2);
+    ASSERT_EQ((endn::load<int64_t, Order::BIG, 6>(buffer)), -0x17FFFFFFF);
+    ASSERT_EQ((endn::load<int32_t, Order::BIG, 3>(buffer, 2)), -0x800000);
+    ASSERT_EQ((endn::load<int32_t, Order::LITTLE, 3>(buffer, 3)), 0x010000);
+    ASSERT_EQ((endn::load<std::uint32_t, Order::BIG, 3>(buffer, 2)), 0x800000u);
+}
+
+TEST(Core, Store)
+{
+    std::uint8_t buffer[8];
+    std::memset(buffer, 0xAA, sizeof(buffer));
+    endn::store<std::uint64_t, Order::BIG, 6>(buffer, 1, 0xFFFF010203040506);
+    ASSERT_THAT(buffer, testing::ElementsAre(0xAA, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0xAA));
+
+    endn::store<int16_t, Order::LITTLE>(buffer, -2);
+    ASSERT_THAT(buffer, testing::ElementsAre(0xFE, 0xFF, 0x02, 0x03, 0x04, 0x05, 0x06, 0xAA));
+
+    char chars[4];
+    endn::store<float, Order::BIG>(chars, 0, 1.0f);
+    ASSERT_EQ(0, std::memcmp(chars, "\x3F\x80\x00\x00", 4));
+}
+
+TEST(Core, RoundTrip)
+{
+    ASSERT_EQ((roundTrip<std::uint8_t, Order::BIG>(0x12)), 0x12);
+    ASSERT_EQ((roundTrip<int8_t, Order::LITTLE>(-5)), -5);
+    ASSERT_EQ((roundTrip<std::uint32_t, Order::BIG>(0xDEADBEEF)), 0xDEADBEEF);
+    ASSERT_EQ((roundTrip<int64_t, Order::LITTLE>(-0x123456789)), -0x123456789);
+    ASSERT_EQ((roundTrip<float, Order::LITTLE>(-1.5f)), -1.5f);
+    ASSERT_EQ((roundTrip<double, Order::BIG>(3.25)), 3.25);
+}
+
+TEST(Core, Float16)
+{
+    // Every binary16 against its definition, and back
+    for(std::uint32_t half = 0; half <= 0xFFFF; ++half)
+    {
+        const float expected = halfValue(std::uint16_t(half));
+        const float value = endn::detail::half_to_float(std::uint16_t(half));
+        if(std::isnan(expected))
+        {
+            ASSERT_TRUE(std::isnan(value));
+            continue;
+        }
+        ASSERT_EQ(floatBits(value), floatBits(expected));
+        ASSERT_EQ(endn::detail::float_to_half(value), half);
+    }
+
+    // Ties round to even, in normal and subnormal range
+    ASSERT_EQ(endn::detail::float_to_half(1.0f + std::ldexp(1.0f, -11)), 0x3C00);
+    ASSERT_EQ(endn::detail::float_to_half(1.0f + 3 * std::ldexp(1.0f, -11)), 0x3C02);
+    ASSERT_EQ(endn::detail::float_to_half(std::ldexp(1.0f, -25)), 0x0000);
+    ASSERT_EQ(endn::detail::float_to_half(3 * std::ldexp(1.0f, -25)), 0x0002);
+    ASSERT_EQ(endn::detail::float_to_half(65519.0f), 0x7BFF);
+    ASSERT_EQ(endn::detail::float_to_half(65520.0f), 0x7C00);
+    ASSERT_EQ(endn::detail::float_to_half(-1e10f), 0xFC00);
+    ASSERT_EQ(endn::detail::float_to_half(std::numeric_limits<float>::quiet_NaN()), 0x7E00);
+
+    std::uint8_t buffer[3] = {};
+    endn::store_float16<Order::BIG>(buffer, 1, -2.0f);
+    ASSERT_THAT(buffer, testing::ElementsAre(0x00, 0xC0, 0x00));
+    ASSERT_EQ(endn::load_float16<Order::BIG>(buffer, 1), -2.0f);
+}
+
+TEST(Core, BFloat16)
+{
+    ASSERT_EQ(endn::detail::bfloat16_to_float(0x3F80), 1.0f);
+    ASSERT_EQ(endn::detail::bfloat16_to_float(0xC040), -3.0f);
+    ASSERT_EQ(endn::detail::float_to_bfloat16(1.0f), 0x3F80);
+    // Ties round to even
+    ASSERT_EQ(endn::detail::float_to_bfloat16(1.0f + std::ldexp(1.0f, -8)), 0x3F80);
+    ASSERT_EQ(endn::detail::float_to_bfloat16(1.0f + 3 * std::ldexp(1.0f, -8)), 0x3F82);
+    ASSERT_EQ(endn::detail::float_to_bfloat16(std::numeric_limits<float>::max()), 0x7F80);
+    ASSERT_EQ(endn::detail::float_to_bfloat16(std::numeric_limits<float>::quiet_NaN()), 0x7FC0);
+
+    std::uint8_t buffer[3] = {};
+    endn::store_bfloat16<Order::LITTLE>(buffer, 1, -3.0f);
+    ASSERT_THAT(buffer, testing::ElementsAre(0x00, 0x40, 0xC0));
+    ASSERT_EQ(endn::load_bfloat16<Order::LITTLE>(buffer, 1), -3.0f);
+}
@@ -2,8 +2,251 @@
 #include <gtest/gtest.h>
 #include <gmock/gmock-matchers.h>
 
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <vector>
+
 using namespace endn::little;
 
+namespace {
+
+const endn::Simd SIMDS[] = {endn::Simd::SCALAR, endn::Simd::SSSE3, endn::Simd::AVX2, endn::Simd::VECTOR};
+const std::size_t STREAMING[] = {endn::STREAMING_NEVER, endn::STREAMING_ALWAYS};
+
+// Restore the selected Simd and streaming threshold at the end of the scope, even when an ASSERT returns early
+class DispatchGuard
+{
+public:
+    DispatchGuard() : simd(endn::GET_SIMD()), threshold(endn::GET_STREAMING_THRESHOLD()) {}
+
+    ~DispatchGuard()
+    {
+        endn::SET_SIMD(simd);
+        endn::SET_STREAMING_THRESHOLD(threshold);
+    }
+
+private:
+    const endn::Simd simd;
+    const std::size_t threshold;
+};
+
+template<typename T, typename Memcpy, typename Get>
+void checkMemcpy(Memcpy memcpyFn, Get getFn, const std::size_t size = sizeof(T))
+{
+    const DispatchGuard guard;
+    for(const std::size_t threshold: STREAMING)
+    {
+        endn::SET_STREAMING_THRESHOLD(threshold);
+        for(const endn::Simd simd: SIMDS)
+        {
+            if(!endn::SET_SIMD(simd))
+                continue;
+            for(std::size_t count = 0; count < 80; ++count)
+            {
+                for(std::size_t offset = 0; offset < size; ++offset)
+                {
+                    std::vector<std::uint8_t> buffer(offset + count * size);
+                    for(std::size_t i = 0; i < buffer.size(); ++i)
+                        buffer[i] = std::uint8_t(i * 7 + 1);
+                    std::vector<T> host(count + 1);
+                    memcpyFn(host.data() + 1, buffer.data() + offset, count);
+                    for(std::size_t i = 0; i < count; ++i)
+                        ASSERT_EQ(host[i + 1], getFn(buffer.data(), offset + i * size));
+                }
+            }
+        }
+    }
+}
+
+// In place swap of host values, read back with the matching GET. Odd counts leave a tail after the vector kernels.
+template<typename T, typename SwapInplace, typename Get>
+void checkSwapInplace(SwapInplace swapFn, Get getFn)
+{
+    const DispatchGuard guard;
+    for(const endn::Simd simd: SIMDS)
+    {
+        if(!endn::SET_SIMD(simd))
+            continue;
+        for(std::size_t count = 0; count < 80; ++count)
+        {
+            std::vector<T> buffer(count);
+            for(std::size_t i = 0; i < count; ++i)
+                buffer[i] = T(0x0123456789ABCDEFull * (i + 1));
+            swapFn(buffer.data(), count);
+            for(std::size_t i = 0; i < count; ++i)
+                ASSERT_EQ(getFn(reinterpret_cast<const std::uint8_t*>(buffer.data()), i * sizeof(T)), T(0x0123456789ABCDEFull * (i + 1)));
+        }
+    }
+}
+
+template<typename T, typename SetArray, typename Set>
+void checkSetArray(SetArray setArrayFn, Set setFn, const std::size_t size)
+{
+    const DispatchGuard guard;
+    for(const std::size_t threshold: STREAMING)
+    {
+        endn::SET_STREAMING_THRESHOLD(threshold);
+        for(const endn::Simd simd: SIMDS)
+        {
+            if(!endn::SET_SIMD(simd))
+                continue;
+            for(std::size_t count = 0; count < 80; ++count)
+            {
+                std::vector<T> host(count);
+                for(std::size_t i = 0; i < count; ++i)
+                    host[i] = T(0x0123456789ABCDEFull * (i + 1));
+                // Trailing padding silence a GCC 12 -Wstringop-overflow false positive on the vectorized setFn loop
+                std::vector<std::uint8_t> expected(1 + count * size + 16);
+                std::vector<std::uint8_t> buffer(1 + count * size + 16);
+                for(std::size_t i = 0; i < count; ++i)
+                    setFn(expected.data(), 1 + i * size, host[i]);
+                std::size_t length = 1;
+                ASSERT_EQ(setArrayFn(buffer.data(), 1, host.data(), count, length), count * size);
+                ASSERT_EQ(length, 1 + count * size);
+                ASSERT_EQ(buffer, expected);
+            }
+        }
+    }
+}
+
+// Every 16 bits float kernel against the scalar GET/SET, NaN payloads aside
+template<typename Memcpy, typename SetArray, typename Get, typename Set>
+void checkFloat16(Memcpy memcpyFn, SetArray setArrayFn, Get getFn, Set setFn)
+{
+    const float values[] = {0.0f, -0.0f, 1.0f, -2.5f, 1.00048828125f, 1.00390625f, 65519.0f, 65520.0f, 1e-7f, 3e-8f, 1e30f,
+        -1e-40f, 3.14159f, 0.1f, std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity(),
+        std::numeric_limits<float>::quiet_NaN()};
+    const std::size_t valuesCount = sizeof(values) / sizeof(values[0]);
+    const DispatchGuard guard;
+    for(const endn::Simd simd: SIMDS)
+    {
+        if(!endn::SET_SIMD(simd))
+            continue;
+        for(std::size_t count = 0; count < 40; ++count)
+        {
+            std::vector<std::uint8_t> buffer(count * 2);
+            for(std::size_t i = 0; i < buffer.size(); ++i)
+                buffer[i] = std::uint8_t(i * 37 + count);
+            std::vector<float> host(count);
+            memcpyFn(host.data(), buffer.data(), count);
+            for(std::size_t i = 0; i < count; ++i)
+            {
+                const float expected = getFn(buffer.data(), i * 2);
+                if(std::isnan(expected))
+                    ASSERT_TRUE(std::isnan(host[i]));
+                else
+                    ASSERT_EQ(std::memcmp(&host[i], &expected, sizeof(float)), 0);
+            }
+
+            for(std::size_t i = 0; i < count; ++i)
+                host[i] = values[(i + count) % valuesCount];
+            std::vector<std::uint8_t> expected(count * 2);
+            std::vector<std::uint8_t> result(count * 2);
+            for(std::size_t i = 0; i < count; ++i)
+                setFn(expected.data(), i * 2, host[i]);
+            ASSERT_EQ(setArrayFn(result.data(), host.data(), count), count * 2);
+            ASSERT_EQ(result, expected);
+        }
+    }
+}
+
+// Every fixed point kernel against the scalar GET/SET_FIXED, saturation and NaN included
+template<typename Format, typename T>
+void checkFixed()
+{
+    const T values[] = {T(0), T(-0.0), T(0.25), T(-0.5), T(0.999), T(1), T(-1), T(-1.5), T(1e30), T(-1e30), T(1.0 / 65536),
+        T(3.0 / 65536), T(-5.0 / 131072), T(12345.678), T(-40000), std::numeric_limits<T>::infinity(),
+        -std::numeric_limits<T>::infinity(), std::numeric_limits<T>::quiet_NaN()};
+    const std::size_t valuesCount = sizeof(values) / sizeof(values[0]);
+    const std::size_t size = sizeof(typename Format::type);
+    const DispatchGuard guard;
+    for(const endn::Simd simd: SIMDS)
+    {
+        if(!endn::SET_SIMD(simd))
+            continue;
+        for(std::size_t count = 0; count < 40; ++count)
+        {
+            std::vector<std::uint8_t> buffer(count * size);
+            for(std::size_t i = 0; i < buffer.size(); ++i)
+                buffer[i] = std::uint8_t(i * 37 + count);
+            std::vector<T> host(count);
+            MEMCPY_FIXED<Format>(host.data(), buffer.data(), count);
+            for(std::size_t i = 0; i < count; ++i)
+                ASSERT_EQ(host[i], (GET_FIXED<Format, T>(buffer.data(), i * size)));
+
+            for(std::size_t i = 0; i < count; ++i)
+                host[i] = values[(i + count) % valuesCount];
+            std::vector<std::uint8_t> expected(count * size);
+            std::vector<std::uint8_t> result(1 + count * size);
+            for(std::size_t i = 0; i < count; ++i)
+                SET_FIXED<Format>(expected.data(), i * size, host[i]);
+            std::size_t length = 1;
+            ASSERT_EQ(SET_ARRAY_FIXED<Format>(result.data(), 1, host.data(), count, length), count * size);
+            ASSERT_EQ(length, 1 + count * size);
+            ASSERT_EQ(std::vector<std::uint8_t>(result.begin() + 1, result.end()), expected);
+        }
+    }
+}
+
+template<typename T>
+std::vector<std::uint8_t> bytesOf(const std::vector<T>& values)
+{
+    const std::uint8_t* begin = reinterpret_cast<const std::uint8_t*>(values.data());
+    return std::vector<std::uint8_t>(begin, begin + values.size() * sizeof(T));
+}
+
+// Every conversion kernel against the scalar one, saturated counts included
+template<typename Wire, typename T>
+void checkConvert()
+{
+    const DispatchGuard guard;
+    for(std::size_t count = 0; count < 40; ++count)
+    {
+        // Keep a growing number of bytes of each value, so some fit and some saturate
+        std::vector<std::uint8_t> buffer(count * sizeof(Wire));
+        for(std::size_t i = 0; i < buffer.size(); ++i)
+            buffer[i] = i % sizeof(Wire) <= i / sizeof(Wire) % sizeof(Wire) ? std::uint8_t(i * 37 + count) : 0;
+        std::vector<std::uint8_t> bytes(count * sizeof(T));
+        for(std::size_t i = 0; i < bytes.size(); ++i)
+            bytes[i] = i % sizeof(T) <= i / sizeof(T) % sizeof(T) ? std::uint8_t(i * 53 + count) : 0;
+        std::vector<T> host(count);
+        if(count)
+            std::memcpy(host.data(), bytes.data(), bytes.size());
+
+        ASSERT_TRUE(endn::SET_SIMD(endn::Simd::SCALAR));
+        std::vector<T> expectedHost(count);
+        const std::size_t expectedUnpacked = MEMCPY_CONVERT<Wire>(expectedHost.data(), buffer.data(), count);
+        std::vector<std::uint8_t> expectedBuffer(count * sizeof(Wire));
+        std::size_t expectedPacked = 0;
+        ASSERT_EQ(SET_ARRAY_CONVERT<Wire>(expectedBuffer.data(), host.data(), count, &expectedPacked), count * sizeof(Wire));
+
+        for(const endn::Simd simd: SIMDS)
+        {
+            if(!endn::SET_SIMD(simd))
+                continue;
+            std::vector<T> result(count);
+            ASSERT_EQ(MEMCPY_CONVERT<Wire>(result.data(), buffer.data(), count), expectedUnpacked);
+            ASSERT_EQ(bytesOf(result), bytesOf(expectedHost));
+
+            std::vector<std::uint8_t> resultBuffer(1 + count * sizeof(Wire));
+            std::size_t packed = 0;
+            std::size_t length = 1;
+            ASSERT_EQ(SET_ARRAY_CONVERT<Wire>(resultBuffer.data(), 1, host.data(), count, length, &packed), count * sizeof(Wire));
+            ASSERT_EQ(length, 1 + count * sizeof(Wire));
+            ASSERT_EQ(std::vector<std::uint8_t>(resultBuffer.begin() + 1, resultBuffer.end()), expectedBuffer);
+            ASSERT_EQ(packed, expectedPacked);
+
+            // Every overload report the saturated values
+            SET_ARRAY_CONVERT<Wire>(resultBuffer.data(), host.data(), count, &packed);
+            SET_ARRAY_CONVERT<Wire>(resultBuffer.data(), 1, host.data(), count, &packed);
+            ASSERT_EQ(packed, 3 * expectedPacked);
+        }
+    }
+}
+
+}
+
 TEST(Little, GET_UINT8)
 {
     std::uint8_t buffer[1] = {0x12};
@@ -23,6 +266,19 @@ TEST(Little, GET_UINT16)
     }
 }
 
+TEST(Little, GET_UINT24)
+{
+    {
+        std::uint8_t buffer[3] = {0x56, 0x34, 0x12};
+        ASSERT_EQ(GET_UINT24(buffer), 0x123456);
+    }
+
+    {
+        std::uint8_t buffer[4] = {0x00, 0x56, 0x34, 0x12};
+        ASSERT_EQ(GET_UINT24(buffer, 1), 0x123456);
+    }
+}
+
 TEST(Little, GET_UINT32)
 {
     {
@@ -49,6 +305,20 @@ TEST(Little, GET_UINT48)
     }
 }
 
+TEST(Little, GET_UINT48_PADDED)
+{
+    // The padding bytes must not leak into the value
+    std::uint8_t buffer[9] = {0x00, 0xBC, 0x9A, 0x78, 0x56, 0x34, 0x12, 0xFF, 0xFF};
+    ASSERT_EQ(GET_UINT48_PADDED(buffer, 1), 0x123456789ABC);
+    ASSERT_EQ(GET_UINT48_PADDED(reinterpret_cast<const char*>(buffer) + 1), 0x123456789ABC);
+
+    buffer[6] = 0xFF;
+    ASSERT_EQ(GET_INT48_PADDED(buffer + 1), -0xCBA9876544);
+    buffer[6] = 0x7F;
+    buffer[7] = 0x80;
+    ASSERT_EQ(GET_INT48_PADDED(reinterpret_cast<const char*>(buffer), 1), 0x7F3456789ABC);
+}
+
 TEST(Little, GET_UINT64)
 {
     {
@@ -62,6 +332,49 @@ TEST(Little, GET_UINT64)
     }
 }
 
+TEST(Little, UINTN)
+{
+    // Padded so that GET_UINTN_PADDED can read 8 bytes from any offset
+    const std::uint8_t buffer[16] = {0x81, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x89};
+    for(std::size_t size = 1; size <= 8; ++size)
+    {
+        for(std::size_t offset = 0; offset < 2; ++offset)
+        {
+            std::uint64_t expected = 0;
+            for(std::size_t i = 0; i < size; ++i)
+                expected |= std::uint64_t(buffer[offset + i]) << (8 * i);
+            const std::uint64_t sign = std::uint64_t(1) << (8 * size - 1);
+            const int64_t expectedSigned = int64_t((expected ^ sign) - sign);
+
+            ASSERT_EQ(GET_UINTN(buffer, offset, size), expected);
+            ASSERT_EQ(GET_UINTN_PADDED(buffer, offset, size), expected);
+            ASSERT_EQ(GET_INTN(buffer, offset, size), expectedSigned);
+            ASSERT_EQ(GET_INTN_PADDED(buffer, offset, size), expectedSigned);
+            ASSERT_EQ(GET_UINTN(reinterpret_cast<const char*>(buffer) + offset, size), expected);
+
+            std::uint8_t set[10];
+            std::memset(set, 0xAA, sizeof(set));
+            std::size_t length = 0;
+            SET_UINTN(set, 1, expected, size, length);
+            ASSERT_EQ(length, size);
+            ASSERT_EQ(0, std::memcmp(set + 1, buffer + offset, size));
+            ASSERT_EQ(set[0], 0xAA);
+            ASSERT_EQ(set[size + 1], 0xAA);
+
+            SET_INTN(set, expectedSigned, size);
+            ASSERT_EQ(GET_INTN(set, size), expectedSigned);
+        }
+    }
+}
+
+TEST(Little, GET_UINT128)
+{
+    std::uint8_t buffer[17] = {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10};
+    ASSERT_EQ(GET_UINT128(buffer, 1), endn::MAKE_UINT128(0x100F0E0D0C0B0A09, 0x0807060504030201));
+    ASSERT_EQ(endn::UINT128_HIGH(GET_UINT128(buffer)), 0x0F0E0D0C0B0A0908);
+    ASSERT_EQ(endn::UINT128_LOW(GET_UINT128(reinterpret_cast<const char*>(buffer))), 0x0706050403020100);
+}
+
 TEST(Little, SET_UINT8)
 {
     std::uint8_t bufferSet[1];
@@ -76,6 +389,20 @@ TEST(Little, SET_UINT16)
     ASSERT_THAT(bufferSet, testing::ElementsAre(0x34, 0x12));
 }
 
+TEST(Little, SET_UINT24)
+{
+    std::uint8_t bufferSet[3];
+    SET_UINT24(bufferSet, 0x123456);
+    ASSERT_THAT(bufferSet, testing::ElementsAre(0x56, 0x34, 0x12));
+}
+
+TEST(Little, SET_INT24)
+{
+    std::uint8_t bufferSet[3];
+    SET_INT24(bufferSet, -70000);
+    ASSERT_THAT(bufferSet, testing::ElementsAre(0x90, 0xEE, 0xFE));
+}
+
 TEST(Little, SET_UINT32)
 {
     std::uint8_t bufferSet[4];
@@ -96,3 +423,732 @@ TEST(Little, SET_UINT64)
     SET_INT64(bufferSet, 0x123456789ABCDEF0);
     ASSERT_THAT(bufferSet, testing::ElementsAre(0xF0, 0xDE, 0xBC, 0x9A, 0x78, 0x56, 0x34, 0x12));
 }
+
+TEST(Little, SET_UINT128)
+{
+    std::uint8_t bufferSet[16];
+    SET_UINT128(bufferSet, endn::MAKE_UINT128(0x0102030405060708, 0x090A0B0C0D0E0F10));
+    const std::uint8_t expected[16] = {0x10, 0x0F, 0x0E, 0x0D, 0x0C, 0x0B, 0x0A, 0x09, 0x08, 0x07, 0x06, 0x05, 0x04, 0x03, 0x02, 0x01};
+    ASSERT_THAT(bufferSet, testing::ElementsAreArray(expected));
+}
+
+TEST(Little, UNALIGNED)
+{
+    const std::uint64_t value = 0x0123456789ABCDEF;
+    for(std::size_t offset = 0; offset < 8; ++offset)
+    {
+        std::uint8_t buffer[24];
+        for(const std::size_t size: {2, 4, 6, 8})
+        {
+            std::memset(buffer, 0xAA, sizeof(buffer));
+            std::uint8_t* buf = buffer + 8 + offset;
+            std::uint64_t read = 0;
+            switch(size)
+            {
+            case 2:
+                SET_UINT16(buf, std::uint16_t(value));
+                read = GET_UINT16(buf);
+                break;
+            case 4:
+                SET_UINT32(buf, std::uint32_t(value));
+                read = GET_UINT32(buf);
+                break;
+            case 6:
+                SET_UINT48(buf, value);
+                read = GET_UINT48(buf);
+                break;
+            default:
+                SET_UINT64(buf, value);
+                read = GET_UINT64(buf);
+                break;
+            }
+            for(std::size_t i = 0; i < sizeof(buffer); ++i)
+            {
+                const std::ptrdiff_t pos = buffer + i - buf;
+                if(pos < 0 || pos >= std::ptrdiff_t(size))
+                    ASSERT_EQ(buffer[i], 0xAA);
+                else
+                    ASSERT_EQ(buffer[i], std::uint8_t(value >> (8 * pos)));
+            }
+            const std::uint64_t mask = size == 8 ? ~std::uint64_t(0) : (std::uint64_t(1) << (8 * size)) - 1;
+            ASSERT_EQ(read, value & mask);
+        }
+    }
+}
+
+TEST(Little, MEMCPY_UINT16)
+{
+    checkMemcpy<std::uint16_t>(
+        [](std::uint16_t* dest, const std::uint8_t* src, std::size_t count)
+        {
+            MEMCPY_UINT16(dest, src, count);
+        },
+        [](const std::uint8_t* buf, std::size_t offset)
+        {
+            return GET_UINT16(buf, offset);
+        });
+}
+
+TEST(Little, MEMCPY_UINT24)
+{
+    checkMemcpy<std::uint32_t>(
+        [](std::uint32_t* dest, const std::uint8_t* src, std::size_t count)
+        {
+            MEMCPY_UINT24(dest, src, count);
+        },
+        [](const std::uint8_t* buf, std::size_t offset)
+        {
+            return GET_UINT24(buf, offset);
+        },
+        endn::UINT24_SIZE);
+}
+
+TEST(Little, MEMCPY_UINT32)
+{
+    checkMemcpy<std::uint32_t>(
+        [](std::uint32_t* dest, const std::uint8_t* src, std::size_t count)
+        {
+            MEMCPY_UINT32(dest, src, count);
+        },
+        [](const std::uint8_t* buf, std::size_t offset)
+        {
+            return GET_UINT32(buf, offset);
+        });
+}
+
+TEST(Little, MEMCPY_UINT48)
+{
+    checkMemcpy<std::uint64_t>(
+        [](std::uint64_t* dest, const std::uint8_t* src, std::size_t count)
+        {
+            MEMCPY_UINT48(dest, src, count);
+        },
+        [](const std::uint8_t* buf, std::size_t offset)
+        {
+            return GET_UINT48(buf, offset);
+        },
+        endn::UINT48_SIZE);
+}
+
+TEST(Little, MEMCPY_UINT64)
+{
+    checkMemcpy<std::uint64_t>(
+        [](std::uint64_t* dest, const std::uint8_t* src, std::size_t count)
+        {
+            MEMCPY_UINT64(dest, src, count);
+        },
+        [](const std::uint8_t* buf, std::size_t offset)
+        {
+            return GET_UINT64(buf, offset);
+        });
+}
+
+TEST(Little, MEMCPY_UINT128)
+{
+    checkMemcpy<endn::uint128_t>(
+        [](endn::uint128_t* dest, const std::uint8_t* src, std::size_t count)
+        {
+            MEMCPY_UINT128(dest, src, count);
+        },
+        [](const std::uint8_t* buf, std::size_t offset)
+        {
+            return GET_UINT128(buf, offset);
+        });
+}
+
+TEST(Little, SWAP_INPLACE_UINT16)
+{
+    checkSwapInplace<std::uint16_t>(
+        [](std::uint16_t* buf, std::size_t count)
+        {
+            SWAP_INPLACE_UINT16(buf, count);
+        },
+        [](const std::uint8_t* buf, std::size_t offset)
+        {
+            return GET_UINT16(buf, offset);
+        });
+}
+
+TEST(Little, SWAP_INPLACE_UINT32)
+{
+    checkSwapInplace<std::uint32_t>(
+        [](std::uint32_t* buf, std::size_t count)
+        {
+            SWAP_INPLACE_UINT32(buf, count);
+        },
+        [](const std::uint8_t* buf, std::size_t offset)
+        {
+            return GET_UINT32(buf, offset);
+        });
+}
+
+TEST(Little, SWAP_INPLACE_UINT64)
+{
+    checkSwapInplace<std::uint64_t>(
+        [](std::uint64_t* buf, std::size_t count)
+        {
+            SWAP_INPLACE_UINT64(buf, count);
+        },
+        [](const std::uint8_t* buf, std::size_t offset)
+        {
+            return GET_UINT64(buf, offset);
+        });
+}
+
+TEST(Little, SET_ARRAY_UINT16)
+{
+    checkSetArray<std::uint16_t>(
+        [](std::uint8_t* buf, std::size_t offset, const std::uint16_t* src, std::size_t count, std::size_t& length)
+        {
+            return SET_ARRAY_UINT16(buf, offset, src, count, length);
+        },
+        [](std::uint8_t* buf, std::size_t offset, std::uint16_t val)
+        {
+            SET_UINT16(buf, offset, val);
+        },
+        endn::UINT16_SIZE);
+}
+
+TEST(Little, SET_ARRAY_UINT24)
+{
+    checkSetArray<std::uint32_t>(
+        [](std::uint8_t* buf, std::size_t offset, const std::uint32_t* src, std::size_t count, std::size_t& length)
+        {
+            return SET_ARRAY_UINT24(buf, offset, src, count, length);
+        },
+        [](std::uint8_t* buf, std::size_t offset, std::uint32_t val)
+        {
+            SET_UINT24(buf, offset, val);
+        },
+        endn::UINT24_SIZE);
+}
+
+TEST(Little, SET_ARRAY_UINT32)
+{
+    checkSetArray<std::uint32_t>(
+        [](std::uint8_t* buf, std::size_t offset, const std::uint32_t* src, std::size_t count, std::size_t& length)
+        {
+            return SET_ARRAY_UINT32(buf, offset, src, count, length);
+        },
+        [](std::uint8_t* buf, std::size_t offset, std::uint32_t val)
+        {
+            SET_UINT32(buf, offset, val);
+        },
+        endn::UINT32_SIZE);
+}
+
+TEST(Little, SET_ARRAY_UINT48)
+{
+    checkSetArray<std::uint64_t>(
+        [](std::uint8_t* buf, std::size_t offset, const std::uint64_t* src, std::size_t count, std::size_t& length)
+        {
+            return SET_ARRAY_UINT48(buf, offset, src, count, length);
+        },
+        [](std::uint8_t* buf, std::size_t offset, std::uint64_t val)
+        {
+            SET_UINT48(buf, offset, val);
+        },
+        endn::UINT48_SIZE);
+}
+
+TEST(Little, SET_ARRAY_UINT64)
+{
+    checkSetArray<std::uint64_t>(
+        [](std::uint8_t* buf, std::size_t offset, const std::uint64_t* src, std::size_t count, std::size_t& length)
+        {
+            return SET_ARRAY_UINT64(buf, offset, src, count, length);
+        },
+        [](std::uint8_t* buf, std::size_t offset, std::uint64_t val)
+        {
+            SET_UINT64(buf, offset, val);
+        },
+        endn::UINT64_SIZE);
+}
+
+TEST(Little, SET_ARRAY_UINT128)
+{
+    const DispatchGuard guard;
+    for(const endn::Simd simd: SIMDS)
+    {
+        if(!endn::SET_SIMD(simd))
+            continue;
+        for(std::size_t count = 0; count < 20; ++count)
+        {
+            std::vector<endn::uint128_t> host(count);
+            for(std::size_t i = 0; i < count; ++i)
+                host[i] = endn::MAKE_UINT128(0x0123456789ABCDEFull * (i + 1), 0xFEDCBA9876543210ull * (i + 3));
+            std::vector<std::uint8_t> expected(1 + count * endn::UINT128_SIZE);
+            std::vector<std::uint8_t> buffer(1 + count * endn::UINT128_SIZE);
+            for(std::size_t i = 0; i < count; ++i)
+                SET_UINT128(expected.data(), 1 + i * endn::UINT128_SIZE, host[i]);
+            std::size_t length = 1;
+            ASSERT_EQ(SET_ARRAY_UINT128(buffer.data(), 1, host.data(), count, length), count * endn::UINT128_SIZE);
+            ASSERT_EQ(length, 1 + count * endn::UINT128_SIZE);
+            ASSERT_EQ(buffer, expected);
+        }
+    }
+}
+
+TEST(Little, GET_FLOAT64)
+{
+    std::uint8_t buffer[9];
+    SET_FLOAT64(buffer, 1, -1.5);
+    ASSERT_EQ(GET_FLOAT64(buffer, 1), -1.5);
+}
+
+TEST(Little, MEMCPY_FLOAT64)
+{
+    std::vector<double> host(37);
+    for(std::size_t i = 0; i < host.size(); ++i)
+        host[i] = 0.5 * double(i) - 3.25;
+    std::vector<std::uint8_t> buffer(1 + host.size() * endn::FLOAT64_SIZE);
+    ASSERT_EQ(SET_ARRAY_FLOAT64(buffer.data(), 1, host.data(), host.size()), host.size() * endn::FLOAT64_SIZE);
+    for(std::size_t i = 0; i < host.size(); ++i)
+        ASSERT_EQ(GET_FLOAT64(buffer.data(), 1 + i * endn::FLOAT64_SIZE), host[i]);
+
+    std::vector<double> result(host.size());
+    MEMCPY_FLOAT64(result.data(), buffer.data() + 1, result.size());
+    ASSERT_EQ(result, host);
+}
+
+TEST(Little, MEMCPY_FLOAT32)
+{
+    std::vector<float> host(37);
+    for(std::size_t i = 0; i < host.size(); ++i)
+        host[i] = 0.25f * float(i) - 2.5f;
+    std::vector<std::uint8_t> buffer(host.size() * endn::FLOAT32_SIZE);
+    SET_ARRAY_FLOAT32(buffer.data(), host.data(), host.size());
+    for(std::size_t i = 0; i < host.size(); ++i)
+        ASSERT_EQ(GET_FLOAT32(buffer.data(), i * endn::FLOAT32_SIZE), host[i]);
+
+    std::vector<float> result(host.size());
+    MEMCPY_FLOAT32(result.data(), buffer.data(), result.size());
+    ASSERT_EQ(result, host);
+}
+
+TEST(Little, FLOAT16)
+{
+    std::uint8_t buffer[3] = {0x00, 0x00, 0x3C};
+    ASSERT_EQ(GET_FLOAT16(buffer, 1), 1.0f);
+    SET_FLOAT16(buffer, -2.5f);
+    ASSERT_THAT(buffer, testing::ElementsAre(0x00, 0xC1, 0x3C));
+    ASSERT_EQ(GET_FLOAT16(reinterpret_cast<const char*>(buffer)), -2.5f);
+
+    SET_BFLOAT16(buffer, 1, 1.0f);
+    ASSERT_THAT(buffer, testing::ElementsAre(0x00, 0x80, 0x3F));
+    ASSERT_EQ(GET_BFLOAT16(buffer, 1), 1.0f);
+    std::size_t length = 0;
+    SET_BFLOAT16(buffer, 0, -3.0f, length);
+    ASSERT_EQ(length, endn::BFLOAT16_SIZE);
+    ASSERT_EQ(GET_BFLOAT16(buffer), -3.0f);
+}
+
+TEST(Little, MEMCPY_FLOAT16)
+{
+    checkFloat16(
+        [](float* dest, const std::uint8_t* src, std::size_t count)
+        {
+            MEMCPY_FLOAT16(dest, src, count);
+        },
+        [](std::uint8_t* buf, const float* src, std::size_t count)
+        {
+            return SET_ARRAY_FLOAT16(buf, src, count);
+        },
+        [](const std::uint8_t* buf, std::size_t offset)
+        {
+            return GET_FLOAT16(buf, offset);
+        },
+        [](std::uint8_t* buf, std::size_t offset, float val)
+        {
+            SET_FLOAT16(buf, offset, val);
+        });
+}
+
+TEST(Little, MEMCPY_BFLOAT16)
+{
+    checkFloat16(
+        [](float* dest, const std::uint8_t* src, std::size_t count)
+        {
+            MEMCPY_BFLOAT16(dest, src, count);
+        },
+        [](std::uint8_t* buf, const float* src, std::size_t count)
+        {
+            return SET_ARRAY_BFLOAT16(buf, src, count);
+        },
+        [](const std::uint8_t* buf, std::size_t offset)
+        {
+            return GET_BFLOAT16(buf, offset);
+        },
+        [](std::uint8_t* buf, std::size_t offset, float val)
+        {
+            SET_BFLOAT16(buf, offset, val);
+        });
+}
+
+TEST(Little, FIXED)
+{
+    std::uint8_t buffer[5] = {0x00, 0x00, 0x40, 0x00, 0x00};
+    ASSERT_EQ(GET_FIXED<endn::Q15>(buffer, 1), 0.5);
+    ASSERT_EQ((GET_FIXED<endn::Q15, float>(reinterpret_cast<const char*>(buffer), 1)), 0.5f);
+    SET_FIXED<endn::Q15>(buffer, -1.0);
+    ASSERT_THAT(buffer, testing::ElementsAre(0x00, 0x80, 0x40, 0x00, 0x00));
+    // Saturate on the way back
+    SET_FIXED<endn::Q15>(buffer, 1.0f);
+    ASSERT_THAT(buffer, testing::ElementsAre(0xFF, 0x7F, 0x40, 0x00, 0x00));
+    SET_FIXED<endn::Q15>(buffer, std::numeric_limits<double>::quiet_NaN());
+    ASSERT_THAT(buffer, testing::ElementsAre(0x00, 0x00, 0x40, 0x00, 0x00));
+
+    std::size_t length = 1;
+    SET_FIXED<endn::Q16_16>(buffer, 1, -1.5, length);
+    ASSERT_EQ(length, 5);
+    ASSERT_THAT(buffer, testing::ElementsAre(0x00, 0x00, 0x80, 0xFE, 0xFF));
+    ASSERT_EQ(GET_FIXED<endn::Q16_16>(buffer, 1), -1.5);
+    SET_FIXED<endn::Q31>(reinterpret_cast<char*>(buffer), 1, 2.0);
+    ASSERT_THAT(buffer, testing::ElementsAre(0x00, 0xFF, 0xFF, 0xFF, 0x7F));
+    // Ties are rounded to even
+    SET_FIXED<endn::Fixed<int16_t, 0>>(buffer, 2.5);
+    ASSERT_EQ(GET_INT16(buffer), 2);
+    SET_FIXED<endn::Fixed<int16_t, 0>>(buffer, -3.5);
+    ASSERT_EQ(GET_INT16(buffer), -4);
+}
+
+TEST(Little, MEMCPY_FIXED)
+{
+    checkFixed<endn::Q15, float>();
+    checkFixed<endn::Q15, double>();
+    checkFixed<endn::Q31, float>();
+    checkFixed<endn::Q31, double>();
+    checkFixed<endn::Q16_16, double>();
+    checkFixed<endn::Fixed<int8_t, 4>, float>();
+    checkFixed<endn::Fixed<std::uint16_t, 8>, double>();
+}
+
+TEST(Little, CONVERT)
+{
+    std::uint8_t buffer[32];
+    SET_UINT16(buffer, 0x1234);
+    SET_INT16(buffer, 2, -2);
+    std::uint32_t u32[2];
+    ASSERT_EQ(MEMCPY_CONVERT<std::uint16_t>(u32, buffer, 2), 0);
+    ASSERT_THAT(u32, testing::ElementsAre(0x1234, 0xFFFE));
+    int64_t i64[2];
+    ASSERT_EQ(MEMCPY_CONVERT<int16_t>(i64, buffer, 2), 0);
+    ASSERT_THAT(i64, testing::ElementsAre(0x1234, -2));
+    // Negative values don't fit in unsigned integers
+    ASSERT_EQ(MEMCPY_CONVERT<int16_t>(u32, buffer, 2), 1);
+    ASSERT_THAT(u32, testing::ElementsAre(0x1234, 0));
+
+    const std::uint64_t counters[] = {1, 0xFFFFFFFF, 0x100000000, std::numeric_limits<std::uint64_t>::max()};
+    std::size_t saturated = 0;
+    ASSERT_EQ(SET_ARRAY_CONVERT<std::uint32_t>(buffer, counters, 4, &saturated), 16);
+    ASSERT_EQ(saturated, 2);
+    ASSERT_EQ(GET_UINT32(buffer), 1);
+    ASSERT_EQ(GET_UINT32(buffer, 4), 0xFFFFFFFF);
+    ASSERT_EQ(GET_UINT32(buffer, 8), 0xFFFFFFFF);
+    ASSERT_EQ(GET_UINT32(buffer, 12), 0xFFFFFFFF);
+
+    SET_FLOAT64(buffer, 1.5);
+    SET_FLOAT64(buffer, 8, 1e300);
+    float floats[2];
+    ASSERT_EQ(MEMCPY_CONVERT<double>(floats, buffer, 2), 1);
+    ASSERT_EQ(floats[0], 1.5f);
+    ASSERT_EQ(floats[1], std::numeric_limits<float>::infinity());
+}
+
+TEST(Little, MEMCPY_CONVERT)
+{
+    checkConvert<std::uint16_t, std::uint32_t>();
+    checkConvert<std::uint16_t, int64_t>();
+    checkConvert<int16_t, int32_t>();
+    checkConvert<int16_t, int64_t>();
+    checkConvert<int32_t, int64_t>();
+    checkConvert<std::uint32_t, std::uint64_t>();
+    checkConvert<std::uint32_t, std::uint16_t>();
+    checkConvert<int32_t, std::uint8_t>();
+    checkConvert<std::uint16_t, std::uint8_t>();
+    checkConvert<std::uint8_t, std::uint16_t>();
+    checkConvert<double, float>();
+    checkConvert<float, double>();
+}
+
+TEST(Little, GET_INT)
+{
+    std::uint8_t buffer[8];
+    SET_INT16(buffer, -2);
+    ASSERT_EQ(GET_INT16(buffer), -2);
+    SET_INT24(buffer, -70000);
+    ASSERT_EQ(GET_INT24(buffer), -70000);
+    SET_INT24(buffer, 0x7FFFFF);
+    ASSERT_EQ(GET_INT24(buffer), 0x7FFFFF);
+    SET_INT32(buffer, -70000);
+    ASSERT_EQ(GET_INT32(buffer), -70000);
+    SET_INT48(buffer, -0x123456789A);
+    ASSERT_EQ(GET_INT48(buffer), -0x123456789A);
+    SET_INT48(buffer, 0x7FFFFFFFFFFF);
+    ASSERT_EQ(GET_INT48(buffer), 0x7FFFFFFFFFFF);
+    SET_INT64(buffer, -0x123456789ABCDEF);
+    ASSERT_EQ(GET_INT64(buffer), -0x123456789ABCDEF);
+}
+
+TEST(Little, MEMCPY_INT24)
+{
+    const DispatchGuard guard;
+    for(const endn::Simd simd: SIMDS)
+    {
+        if(!endn::SET_SIMD(simd))
+            continue;
+        for(std::size_t count = 0; count < 40; ++count)
+        {
+            std::vector<std::int32_t> host(count);
+            for(std::size_t i = 0; i < count; ++i)
+                host[i] = (i % 2 ? -1 : 1) * std::int32_t(0x00123456 >> (i % 20));
+            std::vector<std::uint8_t> buffer(count * endn::INT24_SIZE);
+            SET_ARRAY_INT24(buffer.data(), host.data(), count);
+            std::vector<std::int32_t> result(count);
+            MEMCPY_INT24(result.data(), buffer.data(), count);
+            ASSERT_EQ(result, host);
+        }
+    }
+}
+
+TEST(Little, MEMCPY_INT48)
+{
+    const DispatchGuard guard;
+    for(const endn::Simd simd: SIMDS)
+    {
+        if(!endn::SET_SIMD(simd))
+            continue;
+        for(std::size_t count = 0; count < 40; ++count)
+        {
+            std::vector<std::int64_t> host(count);
+            for(std::size_t i = 0; i < count; ++i)
+                host[i] = (i % 2 ? -1 : 1) * std::int64_t(0x0000123456789ABC >> (i % 40));
+            std::vector<std::uint8_t> buffer(count * endn::INT48_SIZE);
+            SET_ARRAY_INT48(buffer.data(), host.data(), count);
+            std::vector<std::int64_t> result(count);
+            MEMCPY_INT48(result.data(), buffer.data(), count);
+            ASSERT_EQ(result, host);
+        }
+    }
+}
+
+TEST(Little, MEMCPY_INT16)
+{
+    std::vector<std::int16_t> host(33);
+    for(std::size_t i = 0; i < host.size(); ++i)
+        host[i] = std::int16_t(-1000 * std::int16_t(i));
+    std::vector<std::uint8_t> buffer(host.size() * endn::INT16_SIZE);
+    SET_ARRAY_INT16(buffer.data(), host.data(), host.size());
+    ASSERT_EQ(GET_INT16(buffer.data(), 2), -1000);
+    std::vector<std::int16_t> result(host.size());
+    MEMCPY_INT16(result.data(), buffer.data(), result.size());
+    ASSERT_EQ(result, host);
+}
+
+TEST(Little, MEMCPY_INT32)
+{
+    // Half of the source bytes have their high bit set, so the values span both signs
+    checkMemcpy<int32_t>(
+        [](int32_t* dest, const std::uint8_t* src, std::size_t count)
+        {
+            MEMCPY_INT32(dest, src, count);
+        },
+        [](const std::uint8_t* buf, std::size_t offset)
+        {
+            return GET_INT32(buf, offset);
+        });
+}
+
+TEST(Little, MEMCPY_INT64)
+{
+    // Half of the source bytes have their high bit set, so the values span both signs
+    checkMemcpy<int64_t>(
+        [](int64_t* dest, const std::uint8_t* src, std::size_t count)
+        {
+            MEMCPY_INT64(dest, src, count);
+        },
+        [](const std::uint8_t* buf, std::size_t offset)
+        {
+            return GET_INT64(buf, offset);
+        });
+}
+
+TEST(Little, SET_ARRAY_INT32)
+{
+    // The host values wrap around the sign bit, so both signs are written
+    checkSetArray<int32_t>(
+        [](std::uint8_t* buf, std::size_t offset, const int32_t* src, std::size_t count, std::size_t& length)
+        {
+            return SET_ARRAY_INT32(buf, offset, src, count, length);
+        },
+        [](std::uint8_t* buf, std::size_t offset, int32_t val)
+        {
+            SET_INT32(buf, offset, val);
+        },
+        endn::INT32_SIZE);
+}
+
+TEST(Little, SET_ARRAY_INT64)
+{
+    // The host values wrap around the sign bit, so both signs are written
+    checkSetArray<int64_t>(
+        [](std::uint8_t* buf, std::size_t offset, const int64_t* src, std::size_t count, std::size_t& length)
+        {
+            return SET_ARRAY_INT64(buf, offset, src, count, length);
+        },
+        [](std::uint8_t* buf, std::size_t offset, int64_t val)
+        {
+            SET_INT64(buf, offset, val);
+        },
+        endn::INT64_SIZE);
+}
+
+TEST(Little, EXTRACT)
+{
+    const std::size_t stride = 23;
+    const DispatchGuard guard;
+    for(const endn::Simd simd: SIMDS)
+    {
+        if(!endn::SET_SIMD(simd))
+            continue;
+        for(std::size_t count = 0; count < 40; ++count)
+        {
+            std::vector<std::uint8_t> records(count * stride);
+            for(std::size_t i = 0; i < records.size(); ++i)
+                records[i] = std::uint8_t(i * 13 + 5);
+
+            std::vector<std::uint16_t> u16(count);
+            std::vector<std::uint32_t> u32(count);
+            std::vector<std::int64_t> i48(count);
+            std::vector<std::uint64_t> u48(count);
+            std::vector<std::uint64_t> u64(count);
+            std::vector<double> f64(count);
+            EXTRACT_UINT16(u16.data(), records.data(), stride, 1, count);
+            EXTRACT_UINT32(u32.data(), records.data(), stride, 3, count);
+            EXTRACT_INT48(i48.data(), records.data(), stride, 7, count);
+            EXTRACT_UINT48(u48.data(), records.data(), stride, 7, count);
+            EXTRACT_UINT64(u64.data(), records.data(), stride, 15, count);
+            EXTRACT_FLOAT64(f64.data(), records.data(), stride, 15, count);
+            for(std::size_t i = 0; i < count; ++i)
+            {
+                ASSERT_EQ(u16[i], GET_UINT16(records.data(), i * stride + 1));
+                ASSERT_EQ(u32[i], GET_UINT32(records.data(), i * stride + 3));
+                ASSERT_EQ(i48[i], GET_INT48(records.data(), i * stride + 7));
+                ASSERT_EQ(u48[i], GET_UINT48(records.data(), i * stride + 7));
+                ASSERT_EQ(u64[i], GET_UINT64(records.data(), i * stride + 15));
+                ASSERT_EQ(std::memcmp(&f64[i], &u64[i], sizeof(double)), 0);
+            }
+        }
+    }
+}
+
+TEST(Little, GATHER)
+{
+    const DispatchGuard guard;
+    std::vector<std::uint8_t> buffer(4099);
+    for(std::size_t i = 0; i < buffer.size(); ++i)
+        buffer[i] = std::uint8_t(i * 13 + 5);
+    for(const endn::Simd simd: SIMDS)
+    {
+        if(!endn::SET_SIMD(simd))
+            continue;
+        for(std::size_t count = 0; count < 60; ++count)
+        {
+            // Scattered and unaligned, last field ending on the last byte
+            std::vector<std::size_t> offsets(count);
+            for(std::size_t i = 0; i < count; ++i)
+                offsets[i] = (i * 2654435761u) % (buffer.size() - 8);
+            if(count)
+                offsets[count - 1] = buffer.size() - 8;
+
+            std::vector<std::uint16_t> u16(count);
+            std::vector<std::int32_t> i32(count);
+            std::vector<std::uint64_t> u64(count);
+            std::vector<float> f32(count);
+            std::vector<double> f64(count);
+            GATHER_UINT16(u16.data(), buffer.data(), offsets.data(), count);
+            GATHER_INT32(i32.data(), buffer.data(), offsets.data(), count);
+            GATHER_UINT64(u64.data(), buffer.data(), offsets.data(), count);
+            GATHER_FLOAT32(f32.data(), buffer.data(), offsets.data(), count);
+            GATHER_FLOAT64(f64.data(), buffer.data(), offsets.data(), count);
+            for(std::size_t i = 0; i < count; ++i)
+            {
+                ASSERT_EQ(u16[i], GET_UINT16(buffer.data(), offsets[i]));
+                ASSERT_EQ(i32[i], GET_INT32(buffer.data(), offsets[i]));
+                ASSERT_EQ(u64[i], GET_UINT64(buffer.data(), offsets[i]));
+                // Compared as bit patterns, some offsets read NaNs
+                const float expected32 = GET_FLOAT32(buffer.data(), offsets[i]);
+                const double expected64 = GET_FLOAT64(buffer.data(), offsets[i]);
+                ASSERT_EQ(std::memcmp(&f32[i], &expected32, sizeof(float)), 0);
+                ASSERT_EQ(std::memcmp(&f64[i], &expected64, sizeof(double)), 0);
+            }
+        }
+    }
+}
+
+TEST(Little, SCATTER)
+{
+    // Not a multiple of any element size, so every field is unaligned in some records
+    const std::size_t stride = 35;
+    const DispatchGuard guard;
+    // The scratch block of the swap must not be streamed, whatever the threshold
+    for(const std::size_t threshold: STREAMING)
+    {
+        endn::SET_STREAMING_THRESHOLD(threshold);
+        for(const endn::Simd simd: SIMDS)
+        {
+            if(!endn::SET_SIMD(simd))
+                continue;
+            for(std::size_t count = 0; count < 150; count += 7)
+            {
+                std::vector<std::uint16_t> u16(count);
+                std::vector<float> f32(count);
+                std::vector<std::int64_t> i48(count);
+                std::vector<std::uint64_t> u64(count);
+                std::vector<std::uint64_t> u48(count);
+                std::vector<double> f64(count);
+                for(std::size_t i = 0; i < count; ++i)
+                {
+                    u16[i] = std::uint16_t(i * 0x0123);
+                    f32[i] = float(i) * -0.5f;
+                    i48[i] = -std::int64_t(i * 0x0123456789);
+                    u64[i] = i * 0x0123456789ABCDEFull;
+                    u48[i] = (i * 0x0123456789ABull) & 0xFFFFFFFFFFFFull;
+                    f64[i] = double(i) * 1.25e-3 - 7.0;
+                }
+
+                std::vector<std::uint8_t> expected(count * stride, 0xAA);
+                for(std::size_t i = 0; i < count; ++i)
+                {
+                    SET_UINT16(expected.data(), i * stride + 1, u16[i]);
+                    SET_FLOAT32(expected.data(), i * stride + 3, f32[i]);
+                    SET_INT48(expected.data(), i * stride + 7, i48[i]);
+                    SET_UINT64(expected.data(), i * stride + 13, u64[i]);
+                    SET_UINT48(expected.data(), i * stride + 21, u48[i]);
+                    SET_FLOAT64(expected.data(), i * stride + 27, f64[i]);
+                }
+
+                std::vector<std::uint8_t> records(count * stride, 0xAA);
+                SCATTER_UINT16(records.data(), stride, 1, u16.data(), count);
+                SCATTER_FLOAT32(records.data(), stride, 3, f32.data(), count);
+                SCATTER_INT48(records.data(), stride, 7, i48.data(), count);
+                SCATTER_UINT64(records.data(), stride, 13, u64.data(), count);
+                SCATTER_UINT48(records.data(), stride, 21, u48.data(), count);
+                SCATTER_FLOAT64(records.data(), stride, 27, f64.data(), count);
+                ASSERT_EQ(records, expected);
+
+                const endn::Column columns[] = {
+                    {endn::Type::UINT16, 1, u16.data()},
+                    {endn::Type::FLOAT32, 3, f32.data()},
+                    {endn::Type::INT48, 7, i48.data()},
+                    {endn::Type::UINT64, 13, u64.data()},
+                    {endn::Type::UINT48, 21, u48.data()},
+                    {endn::Type::FLOAT64, 27, f64.data()},
+                };
+                std::vector<std::uint8_t> columnRecords(count * stride, 0xAA);
+                SCATTER_COLUMNS(columnRecords.data(), stride, count, columns, 6);
+                ASSERT_EQ(columnRecords, expected);
+            }
+        }
+    }
+}
@@ -0,0 +1,178 @@
+#include <Endn/Parallel.hpp>
+#include <Endn/Tune.hpp>
+#include <gtest/gtest.h>
+#include <gmock/gmock-matchers.h>
+
+#include <atomic>
+#include <vector>
+
+namespace {
+
+// Enough elements to go past ENDN_PARALLEL_THRESHOLD, with an odd tail
+const std::size_t COUNT = (ENDN_PARALLEL_THRESHOLD / 4) + 1237;
+
+class CountingExecutor : public endn::Executor
+{
+public:
+    explicit CountingExecutor(endn::Executor& executor) : executor(executor) {}
+
+    std::size_t concurrency() const override
+    {
+        return executor.concurrency();
+    }
+
+    void run(std::size_t tasks, const std::function<void(std::size_t)>& task) override
+    {
+        ++runs;
+        executor.run(tasks, task);
+    }
+
+    endn::Executor& executor;
+    std::size_t runs = 0;
+};
+
+// Restore the streaming threshold at the end of the scope, even when an ASSERT returns early
+class ThresholdGuard
+{
+public:
+    ThresholdGuard() : threshold(endn::GET_STREAMING_THRESHOLD()) {}
+
+    ~ThresholdGuard()
+    {
+        endn::SET_STREAMING_THRESHOLD(threshold);
+    }
+
+private:
+    const std::size_t threshold;
+};
+
+std::vector<std::uint8_t> makeBuffer(const std::size_t size)
+{
+    std::vector<std::uint8_t> buffer(size);
+    for(std::size_t i = 0; i < size; ++i)
+        buffer[i] = std::uint8_t(i * 7 + i / 251);
+    return buffer;
+}
+
+}
+
+TEST(Parallel, ThreadPool)
+{
+    endn::ThreadPool pool(3);
+    ASSERT_EQ(pool.concurrency(), 4u);
+    for(std::size_t tasks = 0; tasks < 100; tasks += 7)
+    {
+        std::vector<std::atomic<int>> calls(tasks);
+        for(auto& call: calls)
+            call = 0;
+        pool.run(tasks,
+            [&](const std::size_t i)
+            {
+                ++calls[i];
+            });
+        for(const auto& call: calls)
+            ASSERT_EQ(call.load(), 1);
+    }
+}
+
+TEST(Parallel, MEMCPY_UINT32)
+{
+    endn::ThreadPool pool(3);
+    CountingExecutor executor(pool);
+    const auto buffer = makeBuffer(COUNT * endn::UINT32_SIZE + 1);
+
+    std::vector<std::uint32_t> expected(COUNT);
+    std::vector<std::uint32_t> actual(COUNT);
+    endn::big::MEMCPY_UINT32(expected.data(), buffer.data() + 1, COUNT);
+    endn::big::MEMCPY_UINT32_PARALLEL(actual.data(), buffer.data() + 1, COUNT, &executor);
+    ASSERT_EQ(executor.runs, 1u);
+    ASSERT_EQ(expected, actual);
+
+    endn::little::MEMCPY_UINT32(expected.data(), buffer.data() + 1, COUNT);
+    endn::little::MEMCPY_UINT32_PARALLEL(actual.data(), buffer.data() + 1, COUNT, &executor);
+    ASSERT_EQ(expected, actual);
+
+    // Small conversions stay on the calling thread
+    endn::big::MEMCPY_UINT32_PARALLEL(actual.data(), buffer.data(), 100, &executor);
+    ASSERT_EQ(executor.runs, 2u);
+}
+
+TEST(Parallel, Nested)
+{
+    // A parallel function called from a task of the same pool runs inline instead of waiting for the pool
+    endn::ThreadPool pool(2);
+    const auto buffer = makeBuffer(COUNT * endn::UINT32_SIZE);
+    std::vector<std::uint32_t> expected(COUNT);
+    endn::big::MEMCPY_UINT32(expected.data(), buffer.data(), COUNT);
+
+    std::vector<std::vector<std::uint32_t>> actual(3, std::vector<std::uint32_t>(COUNT));
+    pool.run(actual.size(),
+        [&](const std::size_t i)
+        {
+            endn::big::MEMCPY_UINT32_PARALLEL(actual[i].data(), buffer.data(), COUNT, &pool);
+        });
+    for(const auto& values: actual)
+        ASSERT_EQ(expected, values);
+}
+
+TEST(Parallel, Streaming)
+{
+    if(endn::GET_SIMD() == endn::Simd::SCALAR)
+        return;
+
+    // The chunks are smaller than the threshold, the whole destination is bigger
+    const ThresholdGuard guard;
+    const std::size_t threshold = COUNT * sizeof(std::uint32_t) / 2;
+    endn::SET_STREAMING_THRESHOLD(threshold);
+    ASSERT_FALSE(endn::GET_KERNEL(sizeof(std::uint32_t), threshold / 2).streaming);
+
+    endn::ThreadPool pool(3);
+    std::vector<std::uint32_t> dest(COUNT);
+    std::atomic<std::size_t> chunks {0};
+    std::atomic<std::size_t> streamed {0};
+    endn::detail::parallel_for(&pool, dest.data(), COUNT, sizeof(std::uint32_t),
+        [&](const std::size_t, const std::size_t n)
+        {
+            ++chunks;
+            if(n * sizeof(std::uint32_t) < threshold && endn::GET_KERNEL(sizeof(std::uint32_t), n * sizeof(std::uint32_t)).streaming)
+                ++streamed;
+        });
+    ASSERT_GT(chunks.load(), 1u);
+    ASSERT_EQ(streamed.load(), chunks.load());
+}
+
+TEST(Parallel, MEMCPY_INT48)
+{
+    const auto buffer = makeBuffer(COUNT * endn::INT48_SIZE);
+    std::vector<int64_t> expected(COUNT);
+    std::vector<int64_t> actual(COUNT);
+    endn::big::MEMCPY_INT48(expected.data(), buffer.data(), COUNT);
+    endn::big::MEMCPY_INT48_PARALLEL(actual.data(), buffer.data(), COUNT);
+    ASSERT_EQ(expected, actual);
+}
+
+TEST(Parallel, SET_ARRAY_UINT48)
+{
+    endn::ThreadPool pool(5);
+    std::vector<std::uint64_t> src(COUNT);
+    for(std::size_t i = 0; i < COUNT; ++i)
+        src[i] = (i * 0x9E3779B97F4A7C15ull) & 0xFFFFFFFFFFFFull;
+
+    std::vector<std::uint8_t> expected(COUNT * endn::UINT48_SIZE + 3);
+    std::vector<std::uint8_t> actual(COUNT * endn::UINT48_SIZE + 3);
+    ASSERT_EQ(endn::little::SET_ARRAY_UINT48(expected.data() + 3, src.data(), COUNT), COUNT * endn::UINT48_SIZE);
+    ASSERT_EQ(endn::little::SET_ARRAY_UINT48_PARALLEL(actual.data() + 3, src.data(), COUNT, &pool), COUNT * endn::UINT48_SIZE);
+    ASSERT_EQ(expected, actual);
+}
+
+TEST(Parallel, SWAP_INPLACE_UINT64)
+{
+    endn::ThreadPool pool(2);
+    std::vector<std::uint64_t> expected(COUNT);
+    for(std::size_t i = 0; i < COUNT; ++i)
+        expected[i] = i * 0x0102030405060708ull;
+    std::vector<std::uint64_t> actual(expected);
+    endn::big::SWAP_INPLACE_UINT64(expected.data() + 1, COUNT - 1);
+    endn::big::SWAP_INPLACE_UINT64_PARALLEL(actual.data() + 1, COUNT - 1, &pool);
+    ASSERT_EQ(expected, actual);
+}
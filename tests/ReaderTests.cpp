@@ -0,0 +1,90 @@
+#include <Endn/Reader.hpp>
+#include <Endn/Little.hpp>
+#include <Endn/Big.hpp>
+#include <gtest/gtest.h>
+#include <gmock/gmock-matchers.h>
+
+#include <cstring>
+#include <vector>
+
+TEST(Reader, Big)
+{
+    std::uint8_t buffer[64] = {};
+    std::size_t length = 0;
+    endn::big::SET_UINT8(buffer, length, 0xAB, length);
+    endn::big::SET_INT16(buffer, length, -2, length);
+    endn::big::SET_UINT24(buffer, length, 0x123456, length);
+    endn::big::SET_INT32(buffer, length, -70000, length);
+    endn::big::SET_UINT48(buffer, length, 0x0102030405, length);
+    endn::big::SET_UINT64(buffer, length, 0x0102030405060708, length);
+    endn::big::SET_FLOAT32(buffer, length, 1.5f, length);
+    endn::big::SET_FLOAT64(buffer, length, -2.25, length);
+    endn::big::SET_FLOAT16(buffer, length, 0.5f, length);
+    endn::big::SET_FIXED<endn::Q15>(buffer, length, 0.25, length);
+
+    endn::big::Reader reader(buffer, length);
+    ASSERT_TRUE(reader.ensure(length));
+    ASSERT_EQ(reader.uint8(), 0xAB);
+    ASSERT_EQ(reader.int16(), -2);
+    ASSERT_EQ(reader.uint24(), 0x123456u);
+    ASSERT_EQ(reader.int32(), -70000);
+    ASSERT_EQ(reader.uint48(), 0x0102030405u);
+    ASSERT_EQ(reader.uint64(), 0x0102030405060708u);
+    ASSERT_EQ(reader.float32(), 1.5f);
+    ASSERT_EQ(reader.float64(), -2.25);
+    ASSERT_EQ(reader.float16(), 0.5f);
+    ASSERT_EQ(reader.fixed<endn::Q15>(), 0.25);
+    ASSERT_EQ(reader.position(), length);
+    ASSERT_EQ(reader.remaining(), 0);
+    ASSERT_TRUE(reader.ok());
+}
+
+TEST(Reader, Little)
+{
+    std::uint8_t buffer[16] = {};
+    std::size_t length = 0;
+    endn::little::SET_UINT16(buffer, length, 0x1234, length);
+    endn::little::SET_INT48(buffer, length, -3, length);
+    endn::little::SET_UINT32(buffer, length, 0xCAFEBABE, length);
+
+    endn::little::Reader reader(buffer, length);
+    ASSERT_TRUE(reader.ensure(2));
+    ASSERT_EQ(reader.uint16(), 0x1234);
+    ASSERT_TRUE(reader.ensure(10));
+    ASSERT_EQ(reader.int48(), -3);
+    ASSERT_EQ(reader.get<std::uint32_t>(), 0xCAFEBABE);
+    ASSERT_TRUE(reader.ok());
+}
+
+TEST(Reader, Bounds)
+{
+    const std::uint8_t buffer[] = {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06};
+    endn::big::Reader reader(buffer, sizeof(buffer));
+
+    std::uint32_t u32 = 0;
+    ASSERT_TRUE(reader.read(u32));
+    ASSERT_EQ(u32, 0x00010203u);
+    // Not enough bytes: nothing is read and the reader is failed
+    ASSERT_FALSE(reader.read(u32));
+    ASSERT_EQ(u32, 0x00010203u);
+    ASSERT_FALSE(reader.ok());
+    ASSERT_EQ(reader.position(), 4);
+
+    std::uint16_t u16 = 0;
+    ASSERT_TRUE(reader.read(u16));
+    ASSERT_EQ(u16, 0x0405);
+    std::uint8_t bytes[2] = {};
+    ASSERT_FALSE(reader.read(bytes, 2));
+    ASSERT_TRUE(reader.read(bytes, 1));
+    ASSERT_EQ(bytes[0], 0x06);
+    ASSERT_FALSE(reader.ensure(1));
+    ASSERT_TRUE(reader.ensure(0));
+
+    ASSERT_TRUE(reader.seek(1));
+    ASSERT_EQ(reader.current(), buffer + 1);
+    reader.skip(2);
+    ASSERT_EQ(reader.uint8(), 0x03);
+    ASSERT_FALSE(reader.seek(sizeof(buffer) + 1));
+    ASSERT_TRUE(reader.seek(sizeof(buffer)));
+    ASSERT_EQ(reader.remaining(), 0);
+}
@@ -0,0 +1,123 @@
+#include <Endn/Tune.hpp>
+#include <Endn/Little.hpp>
+#include <Endn/Big.hpp>
+#include <gtest/gtest.h>
+#include <gmock/gmock-matchers.h>
+
+#include <cstdio>
+#include <vector>
+
+namespace {
+
+// Keep the calibration short, it runs in Debug and sanitizer builds
+const std::size_t MAX_BYTES = std::size_t(64) << 10;
+
+const char* const TUNING_FILE = "EndnTuneTests.txt";
+
+// Restore the default dispatch after each test, even when an ASSERT returns early
+class Tune : public ::testing::Test
+{
+protected:
+    void TearDown() override
+    {
+        endn::SET_SIMD(simd);
+        endn::SET_STREAMING_THRESHOLD(threshold);
+        endn::RESET_TUNING();
+        std::remove(TUNING_FILE);
+    }
+
+    const endn::Simd simd = endn::GET_SIMD();
+    const std::size_t threshold = endn::GET_STREAMING_THRESHOLD();
+};
+
+}
+
+TEST_F(Tune, Autotune)
+{
+    endn::RESET_TUNING();
+    ASSERT_FALSE(endn::IS_TUNED());
+
+    endn::AUTOTUNE(MAX_BYTES);
+    ASSERT_TRUE(endn::IS_TUNED());
+    for(std::size_t size = 2; size <= 8; size *= 2)
+        for(std::size_t bytes = 1; bytes < (std::size_t(1) << 30); bytes *= 3)
+            ASSERT_TRUE(endn::IS_SIMD_SUPPORTED(endn::GET_KERNEL(size, bytes).simd));
+
+    // Every width and size is converted by its tuned kernel
+    for(const std::size_t count: {std::size_t(3), std::size_t(1000), std::size_t(70001)})
+    {
+        std::vector<std::uint8_t> src(count * 8);
+        for(std::size_t i = 0; i < src.size(); ++i)
+            src[i] = std::uint8_t(i * 13 + i / 7);
+        std::vector<std::uint16_t> dest16(count);
+        std::vector<std::uint32_t> dest32(count);
+        std::vector<std::uint64_t> dest64(count);
+        endn::big::MEMCPY_UINT16(dest16.data(), src.data(), count);
+        endn::big::MEMCPY_UINT32(dest32.data(), src.data(), count);
+        endn::big::MEMCPY_UINT64(dest64.data(), src.data(), count);
+        for(std::size_t i = 0; i < count; ++i)
+        {
+            ASSERT_EQ(dest16[i], endn::big::GET_UINT16(src.data() + i * 2));
+            ASSERT_EQ(dest32[i], endn::big::GET_UINT32(src.data() + i * 4));
+            ASSERT_EQ(dest64[i], endn::big::GET_UINT64(src.data() + i * 8));
+        }
+    }
+}
+
+TEST_F(Tune, SaveLoad)
+{
+    endn::AUTOTUNE(MAX_BYTES);
+    ASSERT_TRUE(endn::SAVE_TUNING(TUNING_FILE));
+
+    std::vector<endn::Kernel> tuned;
+    for(std::size_t size = 2; size <= 8; size *= 2)
+        for(std::size_t bytes = 256; bytes <= (std::size_t(256) << 20); bytes *= 16)
+            tuned.push_back(endn::GET_KERNEL(size, bytes));
+
+    endn::RESET_TUNING();
+    ASSERT_FALSE(endn::IS_TUNED());
+    ASSERT_TRUE(endn::LOAD_TUNING(TUNING_FILE));
+    ASSERT_TRUE(endn::IS_TUNED());
+
+    std::size_t i = 0;
+    for(std::size_t size = 2; size <= 8; size *= 2)
+    {
+        for(std::size_t bytes = 256; bytes <= (std::size_t(256) << 20); bytes *= 16, ++i)
+        {
+            ASSERT_EQ(endn::GET_KERNEL(size, bytes).simd, tuned[i].simd);
+            ASSERT_EQ(endn::GET_KERNEL(size, bytes).streaming, tuned[i].streaming);
+        }
+    }
+}
+
+TEST_F(Tune, LoadInvalid)
+{
+    ASSERT_FALSE(endn::LOAD_TUNING("EndnTuneTestsMissing.txt"));
+
+    std::FILE* file = std::fopen(TUNING_FILE, "w");
+    ASSERT_NE(file, nullptr);
+    std::fprintf(file, "endn-tuning 1 %u\n16 SCALAR SCALAR\n", endn::detail::tuning_cpu());
+    std::fclose(file);
+    ASSERT_FALSE(endn::LOAD_TUNING(TUNING_FILE));
+    ASSERT_FALSE(endn::IS_TUNED());
+
+    // A file tuned on other cpu features is ignored
+    file = std::fopen(TUNING_FILE, "w");
+    ASSERT_NE(file, nullptr);
+    std::fprintf(file, "endn-tuning 1 %u\n", endn::detail::tuning_cpu() + 1);
+    for(unsigned bits = 16; bits <= 64; bits *= 2)
+        std::fprintf(file, "%u SCALAR SCALAR SCALAR SCALAR SCALAR SCALAR\n", bits);
+    std::fclose(file);
+    ASSERT_FALSE(endn::LOAD_TUNING(TUNING_FILE));
+    ASSERT_FALSE(endn::IS_TUNED());
+}
+
+TEST_F(Tune, SetSimdResetTuning)
+{
+    endn::AUTOTUNE(MAX_BYTES);
+    ASSERT_TRUE(endn::IS_TUNED());
+
+    ASSERT_TRUE(endn::SET_SIMD(endn::Simd::SCALAR));
+    ASSERT_FALSE(endn::IS_TUNED());
+    ASSERT_EQ(endn::GET_KERNEL(4, 1024).simd, endn::Simd::SCALAR);
+}
@@ -0,0 +1,178 @@
+#include <Endn/Writer.hpp>
+#include <Endn/Reader.hpp>
+#include <Endn/Little.hpp>
+#include <Endn/Big.hpp>
+#include <gtest/gtest.h>
+#include <gmock/gmock-matchers.h>
+
+#include <memory>
+#include <vector>
+
+namespace {
+
+std::size_t allocations = 0;
+
+// Count the heap allocations of the writers
+template<typename T>
+struct CountingAllocator
+{
+    typedef T value_type;
+
+    CountingAllocator() = default;
+    template<typename U>
+    CountingAllocator(const CountingAllocator<U>&)
+    {
+    }
+
+    T* allocate(const std::size_t n)
+    {
+        ++allocations;
+        return std::allocator<T>().allocate(n);
+    }
+
+    void deallocate(T* p, const std::size_t n)
+    {
+        std::allocator<T>().deallocate(p, n);
+    }
+
+    bool operator==(const CountingAllocator&) const
+    {
+        return true;
+    }
+
+    bool operator!=(const CountingAllocator&) const
+    {
+        return false;
+    }
+};
+
+typedef endn::Writer<endn::Order::BIG, ENDN_WRITER_INLINE_SIZE, CountingAllocator<std::uint8_t>> CountingWriter;
+
+}
+
+TEST(Writer, Big)
+{
+    endn::big::Writer writer;
+    writer.reserve(50)
+        .uint8(0xAB)
+        .int16(-2)
+        .uint24(0x123456)
+        .int32(-70000)
+        .uint48(0x0102030405)
+        .uint64(0x0102030405060708)
+        .float32(1.5f)
+        .float64(-2.25)
+        .float16(0.5f)
+        .fixed<endn::Q15>(0.25)
+        .bytes("\x01\x02\x03\x04\x05\x06\x07\x08\x09\x0A", 10);
+    ASSERT_EQ(writer.size(), 50);
+    ASSERT_TRUE(writer.isInline());
+
+    std::uint8_t expected[50] = {};
+    std::size_t length = 0;
+    endn::big::SET_UINT8(expected, length, 0xAB, length);
+    endn::big::SET_INT16(expected, length, -2, length);
+    endn::big::SET_UINT24(expected, length, 0x123456, length);
+    endn::big::SET_INT32(expected, length, -70000, length);
+    endn::big::SET_UINT48(expected, length, 0x0102030405, length);
+    endn::big::SET_UINT64(expected, length, 0x0102030405060708, length);
+    endn::big::SET_FLOAT32(expected, length, 1.5f, length);
+    endn::big::SET_FLOAT64(expected, length, -2.25, length);
+    endn::big::SET_FLOAT16(expected, length, 0.5f, length);
+    endn::big::SET_FIXED<endn::Q15>(expected, length, 0.25, length);
+    for(std::uint8_t i = 1; i <= 10; ++i)
+        endn::big::SET_UINT8(expected, length, i, length);
+    ASSERT_EQ(length, writer.size());
+    ASSERT_EQ(std::vector<std::uint8_t>(writer.data(), writer.data() + writer.size()),
+        std::vector<std::uint8_t>(expected, expected + length));
+}
+
+TEST(Writer, Little)
+{
+    endn::little::Writer writer;
+    writer.write(std::uint16_t(0x1234)).write(int64_t(-3)).write(2.5f);
+    writer.reserve(6).int48(-5);
+
+    endn::little::Reader reader(writer.data(), writer.size());
+    ASSERT_TRUE(reader.ensure(20));
+    ASSERT_EQ(reader.uint16(), 0x1234);
+    ASSERT_EQ(reader.int64(), -3);
+    ASSERT_EQ(reader.float32(), 2.5f);
+    ASSERT_EQ(reader.int48(), -5);
+    ASSERT_EQ(reader.remaining(), 0);
+}
+
+TEST(Writer, Growth)
+{
+    allocations = 0;
+    {
+        // Messages that fit in the inline buffer never allocate
+        CountingWriter writer;
+        for(std::size_t i = 0; i < ENDN_WRITER_INLINE_SIZE / 4; ++i)
+            writer.write(std::uint32_t(i));
+        ASSERT_TRUE(writer.isInline());
+        ASSERT_EQ(allocations, 0);
+
+        endn::Buffer<CountingAllocator<std::uint8_t>> small = writer.release();
+        ASSERT_EQ(allocations, 1);
+        ASSERT_EQ(small.size(), ENDN_WRITER_INLINE_SIZE);
+        ASSERT_EQ(endn::big::GET_UINT32(small.data(), 8), 2);
+        ASSERT_EQ(writer.size(), 0);
+
+        // Then the capacity double
+        allocations = 0;
+        for(std::uint32_t i = 0; i < 1000; ++i)
+            writer.write(i);
+        ASSERT_FALSE(writer.isInline());
+        ASSERT_EQ(allocations, 4);
+        ASSERT_EQ(writer.capacity(), 16 * ENDN_WRITER_INLINE_SIZE);
+        for(std::uint32_t i = 0; i < 1000; ++i)
+            ASSERT_EQ(endn::big::GET_UINT32(writer.data(), i * 4), i);
+
+        // The heap storage is handed off without copy
+        const std::uint8_t* data = writer.data();
+        endn::Buffer<CountingAllocator<std::uint8_t>> buffer = writer.release();
+        ASSERT_EQ(buffer.data(), data);
+        ASSERT_EQ(buffer.size(), 4000);
+        ASSERT_EQ(allocations, 4);
+        ASSERT_TRUE(writer.isInline());
+        ASSERT_EQ(writer.size(), 0);
+
+        // A reservation bigger than twice the capacity is allocated at once
+        writer.reserve(10000);
+        ASSERT_EQ(writer.capacity(), 10000);
+        ASSERT_EQ(allocations, 5);
+
+        CountingWriter moved(std::move(writer));
+        ASSERT_EQ(moved.capacity(), 10000);
+        ASSERT_TRUE(writer.isInline());
+    }
+}
+
+TEST(Writer, Release)
+{
+    allocations = 0;
+    {
+        CountingWriter writer;
+        writer.write(std::uint32_t(0x01020304)).write(std::uint16_t(0x0506));
+        ASSERT_EQ(endn::big::GET_UINT32(writer.data()), 0x01020304);
+        ASSERT_EQ(writer.size(), 6);
+        ASSERT_EQ(allocations, 0);
+
+        // Inline bytes are copied in an allocation of their exact size
+        endn::Buffer<CountingAllocator<std::uint8_t>> buffer = writer.release();
+        ASSERT_EQ(allocations, 1);
+        ASSERT_EQ(buffer.size(), 6);
+        ASSERT_EQ(buffer.capacity(), 6);
+        ASSERT_NE(buffer.data(), writer.data());
+        ASSERT_EQ(endn::big::GET_UINT16(buffer.data(), 4), 0x0506);
+        ASSERT_TRUE(writer.isInline());
+        ASSERT_EQ(writer.size(), 0);
+
+        // Nothing to hand off, nothing allocated
+        endn::Buffer<CountingAllocator<std::uint8_t>> empty = writer.release();
+        ASSERT_EQ(allocations, 1);
+        ASSERT_TRUE(empty.empty());
+        ASSERT_EQ(empty.data(), nullptr);
+    }
+}
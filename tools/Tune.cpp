@@ -0,0 +1,42 @@
+// Calibrate the bulk swap kernels of this machine and write them to a tuning file.
+// Usage: EndnTune <file> [maxBytes]
+// The file is loaded with endn::LOAD_TUNING, or with the ENDN_TUNING_FILE environment variable and ENDN_AUTOTUNE.
+
+// Library Headers
+#include <Endn/Tune.hpp>
+
+// C++ Headers
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+
+int main(int argc, char** argv)
+{
+    if(argc < 2)
+    {
+        std::fprintf(stderr, "Usage: %s <file> [maxBytes]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    const std::size_t maxBytes = argc > 2 ? std::size_t(std::strtoull(argv[2], nullptr, 10)) : ENDN_TUNE_MAX_BYTES;
+    endn::AUTOTUNE(maxBytes);
+
+    for(std::size_t size = 2; size <= 8; size *= 2)
+    {
+        std::printf("%2u bits:", unsigned(size * 8));
+        for(std::size_t bytes = 256; bytes <= (std::size_t(256) << 20); bytes *= 16)
+        {
+            const endn::Kernel kernel = endn::GET_KERNEL(size, bytes);
+            const std::uint8_t id = std::uint8_t(std::uint8_t(kernel.simd) | (kernel.streaming ? endn::detail::KERNEL_STREAM : 0));
+            std::printf(" %s", endn::detail::kernel_name(id));
+        }
+        std::printf("\n");
+    }
+
+    if(!endn::SAVE_TUNING(argv[1]))
+    {
+        std::fprintf(stderr, "Can't write %s\n", argv[1]);
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}